@@ -6,8 +6,12 @@
  *
  * Architecture:
  *   - Multi-Changer: Each changer has name, location, slot count; own JSON file
- *   - Cache: Only SLOT_CACHE_SIZE slots in RAM; rest on SD card
- *   - pending_changer_switch: Defer load/save from input callback to main loop (avoids BusFault)
+ *   - Cache: LRU of SLOT_CACHE_SIZE slots in RAM (strings in a bump arena), dirty entries written back on eviction; rest on SD card
+ *   - Storage worker: own thread + request queue runs all SD I/O (load, save, flush); input
+ *     handling only posts requests, views show "Loading" until the worker redraws
+ *   - Main loop: sleeps on an event queue fed by the input callback, splash timer and worker
+ *     results; app mutex serializes it with worker requests and draw (busy frame, never waits)
+ *   - Prefetch: worker reads slots ahead of the list cursor while input is idle
  *   - Views: Main menu, Slot list, Slot details, Add/Edit CD, Track mgmt, Settings, Statistics, Changers
  */
 
@@ -19,6 +23,237 @@
 #include <storage/storage.h>
 #include <furi.h>
 #include <string.h>
+#include <stdlib.h>
+#include <stddef.h>
+
+/* Character set for text input (Add/Edit Changer, CD fields). Index 39 = DEL. */
+static const char* CHAR_SET = "ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789 .-,";
+#define CHAR_DEL_INDEX ((int32_t)39)
+
+/* === Packed strings - CHAR_SET text as base-40, three characters per 16-bit word === */
+// Layout: header byte = length (packed), then little-endian words c0*1600 + c1*40 + c2.
+// Text with other characters (imported JSON) or over PACKED_MAX_CHARS long is kept raw.
+#define PACKED_RAW 0xFF        // Header of a raw string: NUL-terminated bytes follow
+#define PACKED_MAX_CHARS 127
+#define PACKED_MAX_SIZE (MAX_NOTES_LENGTH + 2)  // Largest encoding (raw notes)
+
+static const uint8_t packed_empty[1] = {0};
+
+// Position of c in CHAR_SET, or -1 if it cannot be packed
+static int32_t flipchanger_pack_index(char c) {
+    const char* found = (c != '\0') ? strchr(CHAR_SET, c) : NULL;
+    return found ? (int32_t)(found - CHAR_SET) : -1;
+}
+
+// Encode str into out (PACKED_MAX_SIZE bytes); returns the encoded size
+static size_t flipchanger_pack_string(const char* str, uint8_t* out) {
+    size_t len = strlen(str);
+    bool packable = len <= PACKED_MAX_CHARS;
+    for(size_t i = 0; packable && i < len; i++) {
+        packable = flipchanger_pack_index(str[i]) >= 0;
+    }
+    if(!packable) {
+        if(len > PACKED_MAX_SIZE - 2) len = PACKED_MAX_SIZE - 2;
+        out[0] = PACKED_RAW;
+        memcpy(out + 1, str, len);
+        out[len + 1] = '\0';
+        return len + 2;
+    }
+    out[0] = (uint8_t)len;
+    size_t size = 1;
+    for(size_t i = 0; i < len; i += 3) {
+        uint32_t word = 0;
+        for(size_t k = i; k < i + 3; k++) {
+            word = word * 40 + ((k < len) ? (uint32_t)flipchanger_pack_index(str[k]) : 0);
+        }
+        out[size++] = word & 0xFF;
+        out[size++] = word >> 8;
+    }
+    return size;
+}
+
+// Encoded size of packed
+static size_t flipchanger_packed_size(const uint8_t* packed) {
+    if(packed[0] == PACKED_RAW) return strlen((const char*)packed + 1) + 2;
+    return 1 + 2 * ((packed[0] + 2) / 3);
+}
+
+// Decode packed into out (truncated to out_size - 1 characters)
+static void flipchanger_unpack_string(const uint8_t* packed, char* out, size_t out_size) {
+    if(out_size == 0) return;
+    if(packed[0] == PACKED_RAW) {
+        strncpy(out, (const char*)packed + 1, out_size - 1);
+        out[out_size - 1] = '\0';
+        return;
+    }
+    size_t len = packed[0];
+    if(len > out_size - 1) len = out_size - 1;
+    const uint8_t* word = packed + 1;
+    for(size_t i = 0; i < len; i += 3, word += 2) {
+        uint32_t value = word[0] | ((uint32_t)word[1] << 8);
+        char chars[3] = {CHAR_SET[(value / 1600) % 40], CHAR_SET[(value / 40) % 40], CHAR_SET[value % 40]};
+        for(size_t k = 0; k < 3 && i + k < len; k++) out[i + k] = chars[k];
+    }
+    out[len] = '\0';
+}
+
+/* === Slot cache - compact records, strings packed and bump-allocated in the cache arena === */
+
+// Drop every string (keeps one block for the next load)
+static void flipchanger_arena_reset(FlipChangerApp* app) {
+    SlotArenaBlock* block = app->arena;
+    if(!block) return;
+    while(block->next) {
+        SlotArenaBlock* next = block->next->next;
+        free(block->next);
+        block->next = next;
+    }
+    block->used = 0;
+}
+
+static void flipchanger_arena_free(FlipChangerApp* app) {
+    flipchanger_arena_reset(app);
+    free(app->arena);
+    app->arena = NULL;
+}
+
+// Copy an encoded string into the arena
+static const uint8_t* flipchanger_arena_copy(FlipChangerApp* app, const uint8_t* packed, size_t size) {
+    if(size <= 1) return packed_empty;
+    SlotArenaBlock* block = app->arena;
+    if(!block || block->used + size > SLOT_ARENA_BLOCK) {
+        block = malloc(sizeof(SlotArenaBlock));
+        block->next = app->arena;
+        block->used = 0;
+        app->arena = block;
+    }
+    uint8_t* copy = (uint8_t*)block->data + block->used;
+    memcpy(copy, packed, size);
+    block->used += size;
+    return copy;
+}
+
+// Pack str into the arena, unless old (may be NULL) already holds the same text
+static const uint8_t* flipchanger_arena_intern(FlipChangerApp* app, const uint8_t* old, const char* str) {
+    uint8_t packed[PACKED_MAX_SIZE];
+    size_t size = flipchanger_pack_string(str, packed);
+    if(old && flipchanger_packed_size(old) == size && memcmp(old, packed, size) == 0) return old;
+    return flipchanger_arena_copy(app, packed, size);
+}
+
+// Re-pack the arena once edits and evictions have left it spread over too many blocks
+static void flipchanger_arena_compact(FlipChangerApp* app);
+static void flipchanger_arena_trim(FlipChangerApp* app) {
+    int32_t blocks = 0;
+    for(SlotArenaBlock* block = app->arena; block; block = block->next) blocks++;
+    if(blocks > SLOT_ARENA_COMPACT_BLOCKS) flipchanger_arena_compact(app);
+}
+
+/**
+ * Store a full slot in cache entry cache_index. With reuse, strings that did not
+ * change keep their arena copy (committing edits); otherwise every string is copied
+ * (loads) and an open copy of the slot is dropped as stale. Returns true when the
+ * entry's contents changed.
+ */
+static bool flipchanger_cache_put(FlipChangerApp* app, int32_t cache_index, const Slot* slot, bool reuse) {
+    CachedSlot* cached = &app->slots[cache_index];
+    CachedSlot before = *cached;
+    cached->slot_number = slot->slot_number;
+    cached->occupied = slot->occupied;
+    cached->year = slot->cd.year;
+    cached->disc_number = slot->cd.disc_number;
+    cached->track_count = slot->cd.track_count;
+    cached->total_seconds = slot->cd.total_seconds;
+    cached->artist = flipchanger_arena_intern(app, reuse ? cached->artist : NULL, slot->cd.artist);
+    cached->album_artist = flipchanger_arena_intern(app, reuse ? cached->album_artist : NULL, slot->cd.album_artist);
+    cached->album = flipchanger_arena_intern(app, reuse ? cached->album : NULL, slot->cd.album);
+    cached->genre = flipchanger_arena_intern(app, reuse ? cached->genre : NULL, slot->cd.genre);
+    cached->notes = flipchanger_arena_intern(app, reuse ? cached->notes : NULL, slot->cd.notes);
+    if(!reuse && app->open_slot_index == slot->slot_number - 1) {
+        app->open_slot_index = -1;
+    }
+    bool changed = memcmp(&before, cached, sizeof(CachedSlot)) != 0;
+    flipchanger_arena_trim(app);
+    return changed;
+}
+
+// Expand a cache entry back into a full fixed-size slot
+static void flipchanger_cache_expand(const CachedSlot* cached, Slot* slot) {
+    memset(slot, 0, sizeof(Slot));
+    slot->slot_number = cached->slot_number;
+    slot->occupied = cached->occupied;
+    if(!cached->occupied) return;
+    CD* cd = &slot->cd;
+    flipchanger_unpack_string(cached->artist, cd->artist, MAX_ARTIST_LENGTH);
+    flipchanger_unpack_string(cached->album_artist, cd->album_artist, MAX_ARTIST_LENGTH);
+    flipchanger_unpack_string(cached->album, cd->album, MAX_ALBUM_LENGTH);
+    flipchanger_unpack_string(cached->genre, cd->genre, MAX_GENRE_LENGTH);
+    flipchanger_unpack_string(cached->notes, cd->notes, MAX_NOTES_LENGTH);
+    cd->year = cached->year;
+    cd->disc_number = cached->disc_number;
+    cd->track_count = cached->track_count;
+    cd->total_seconds = cached->total_seconds;
+}
+
+// Copy the live strings into fresh blocks and free the old ones (edits and evictions leave text behind)
+static void flipchanger_arena_compact(FlipChangerApp* app) {
+    SlotArenaBlock* old = app->arena;
+    app->arena = NULL;
+    for(int32_t i = 0; i < SLOT_CACHE_SIZE; i++) {
+        CachedSlot* cached = &app->slots[i];
+        cached->artist = flipchanger_arena_copy(app, cached->artist, flipchanger_packed_size(cached->artist));
+        cached->album_artist = flipchanger_arena_copy(app, cached->album_artist, flipchanger_packed_size(cached->album_artist));
+        cached->album = flipchanger_arena_copy(app, cached->album, flipchanger_packed_size(cached->album));
+        cached->genre = flipchanger_arena_copy(app, cached->genre, flipchanger_packed_size(cached->genre));
+        cached->notes = flipchanger_arena_copy(app, cached->notes, flipchanger_packed_size(cached->notes));
+    }
+    while(old) {
+        SlotArenaBlock* next = old->next;
+        free(old);
+        old = next;
+    }
+}
+
+// Cache entry holding slot_index, or -1
+static int32_t flipchanger_cache_find(const FlipChangerApp* app, int32_t slot_index) {
+    for(int32_t i = 0; i < SLOT_CACHE_SIZE; i++) {
+        if(app->slots[i].slot_number == slot_index + 1) return i;
+    }
+    return -1;
+}
+
+// Write edits made through the open slot back into its cache entry (marks it dirty)
+static void flipchanger_cache_commit(FlipChangerApp* app) {
+    if(app->open_slot_index < 0) return;
+    int32_t cache_index = flipchanger_cache_find(app, app->open_slot_index);
+    if(cache_index < 0) return;
+    if(flipchanger_cache_put(app, cache_index, &app->open_slot, true)) {
+        app->slots[cache_index].dirty = true;
+    }
+}
+
+// Mark every cache entry free; frees the arena
+static void flipchanger_clear_cache(FlipChangerApp* app) {
+    flipchanger_arena_reset(app);
+    app->open_slot_index = -1;
+    for(int32_t i = 0; i < SLOT_CACHE_SIZE; i++) {
+        CachedSlot* cached = &app->slots[i];
+        memset(cached, 0, sizeof(CachedSlot));
+        cached->artist = cached->album_artist = cached->album = cached->genre = cached->notes = packed_empty;
+    }
+}
+
+// Entry to load into: a free one, else the least recently used (never the open slot's)
+static int32_t flipchanger_cache_victim(const FlipChangerApp* app) {
+    int32_t victim = -1;
+    for(int32_t i = 0; i < SLOT_CACHE_SIZE; i++) {
+        const CachedSlot* cached = &app->slots[i];
+        if(cached->slot_number == 0) return i;
+        if(cached->slot_number - 1 == app->open_slot_index) continue;
+        if(victim < 0 || cached->last_used < app->slots[victim].last_used) victim = i;
+    }
+    return victim;
+}
 
 // Initialize slots (only cache in memory, full data on SD card)
 void flipchanger_init_slots(FlipChangerApp* app, int32_t total_slots) {
@@ -26,214 +261,660 @@ void flipchanger_init_slots(FlipChangerApp* app, int32_t total_slots) {
                        (total_slots > MAX_SLOTS) ? MAX_SLOTS : total_slots;
     
     // Only initialize cache slots (memory efficient)
-    for(int32_t i = 0; i < SLOT_CACHE_SIZE; i++) {
-        app->slots[i].slot_number = i + 1;
-        app->slots[i].occupied = false;
-        memset(&app->slots[i].cd, 0, sizeof(CD));
-        app->slots[i].cd.track_count = 0;
-    }
+    flipchanger_clear_cache(app);
+    app->cache_clock = 0;
+    app->cache_hits = 0;
+    app->cache_misses = 0;
     
-    app->cache_start_index = 0;
     app->current_slot_index = 0;
     app->selected_index = 0;
     app->scroll_offset = 0;
     app->details_scroll_offset = 0;
     app->editing_slot_count = false;
     app->edit_slot_count_pos = 0;
+    app->tracks_slot = -1;
+    app->tracks_dirty = false;
+}
+
+static bool flipchanger_read_slot(FlipChangerApp* app, int32_t slot_index, Slot* slot);  // Defined with storage code
+static bool flipchanger_bin_read_slot(FlipChangerApp* app, int32_t slot_index, Slot* slot);
+static bool flipchanger_bin_write_slot(FlipChangerApp* app, const Slot* slot);
+static bool flipchanger_bin_write_dirty(FlipChangerApp* app);
+static bool flipchanger_bin_open_store(FlipChangerApp* app);
+static uint32_t flipchanger_journal_append(FlipChangerApp* app, const Slot* slot);
+static void flipchanger_summary_put(FlipChangerApp* app, const Slot* slot);
+static void flipchanger_summary_put_cached(FlipChangerApp* app, const CachedSlot* slot);
+static bool flipchanger_summary_save(FlipChangerApp* app);
+static bool flipchanger_summary_save_slot(FlipChangerApp* app, int32_t slot_index);
+static bool flipchanger_summary_current(FlipChangerApp* app);
+static void flipchanger_summary_restamp(FlipChangerApp* app);
+static void flipchanger_summary_load(FlipChangerApp* app);
+static int32_t flipchanger_list_rows(const FlipChangerApp* app);
+static int32_t flipchanger_list_slot(const FlipChangerApp* app, int32_t row);
+static void flipchanger_breakdown_put(
+    FlipChangerApp* app, int32_t slot_index, bool occupied, const char* artist, const char* genre, int32_t year);
+static void flipchanger_breakdown_put_cached(FlipChangerApp* app, const CachedSlot* slot);
+static void flipchanger_breakdown_reset(FlipChangerApp* app);
+static bool flipchanger_tracks_read(FlipChangerApp* app, const Slot* slot, TrackList* tracks);
+static bool flipchanger_tracks_flush(FlipChangerApp* app);
+static File* flipchanger_tracks_open(FlipChangerApp* app, FS_AccessMode access, FS_OpenMode mode);
+static bool flipchanger_tracks_read_record(File* file, int32_t slot_index, TrackList* tracks);
+static bool flipchanger_tracks_write_record(File* file, int32_t slot_index, const TrackList* tracks);
+static void flipchanger_tracks_migrate(FlipChangerApp* app);
+static void flipchanger_terms_mark(FlipChangerApp* app, int32_t slot_index);
+static void flipchanger_terms_restamp(FlipChangerApp* app);
+static void flipchanger_terms_load(FlipChangerApp* app);
+static void flipchanger_terms_abort(FlipChangerApp* app);
+static void flipchanger_catalog_put(FlipChangerApp* app, int32_t slot_index, bool occupied, const char* artist, const char* album);
+static void flipchanger_catalog_put_cached(FlipChangerApp* app, const CachedSlot* slot);
+static void flipchanger_catalog_restamp(FlipChangerApp* app);
+static void flipchanger_catalog_load(FlipChangerApp* app);
+static bool flipchanger_catalog_ready(FlipChangerApp* app);
+static void flipchanger_catalog_narrow(FlipChangerApp* app);
+static void flipchanger_search_forget(FlipChangerApp* app);
+
+/**
+ * Write one slot to the current store: binary - one seek + one record write;
+ * JSON - one appended journal record, folded into the slots file once the journal grows.
+ */
+static bool flipchanger_store_write_slot(FlipChangerApp* app, const Slot* slot) {
+    bool ok;
+    if(app->binary_store) {
+        ok = flipchanger_bin_write_slot(app, slot);
+    } else {
+        uint32_t journal_size = flipchanger_journal_append(app, slot);
+        if(journal_size >= JOURNAL_COMPACT_SIZE) flipchanger_journal_compact(app);
+        ok = journal_size > 0;
+    }
+    if(ok) {
+        flipchanger_summary_put(app, slot);
+        flipchanger_summary_save_slot(app, slot->slot_number - 1);
+        flipchanger_terms_mark(app, slot->slot_number - 1);
+        flipchanger_terms_restamp(app);
+        flipchanger_catalog_put(app, slot->slot_number - 1, slot->occupied, slot->cd.artist, slot->cd.album);
+        flipchanger_catalog_restamp(app);
+    }
+    return ok;
+}
+
+// Write a dirty cache entry back on its own (eviction)
+static bool flipchanger_cache_write_back(FlipChangerApp* app, int32_t cache_index) {
+    CachedSlot* cached = &app->slots[cache_index];
+    if(!cached->dirty) return true;
+    Slot* slot = malloc(sizeof(Slot));
+    flipchanger_cache_expand(cached, slot);
+    bool ok = flipchanger_store_write_slot(app, slot);
+    free(slot);
+    if(ok) cached->dirty = false;
+    return ok;
+}
+
+// Read slot_index from SD into cache entry cache_index, writing back what it held first
+static bool flipchanger_cache_load(FlipChangerApp* app, int32_t cache_index, int32_t slot_index) {
+    if(!flipchanger_cache_write_back(app, cache_index)) return false;  // Keep unsaved edits cached
+    Slot* slot = malloc(sizeof(Slot));
+    bool ok = slot && flipchanger_read_slot(app, slot_index, slot);
+    if(ok) {
+        flipchanger_cache_put(app, cache_index, slot, false);
+        app->slots[cache_index].dirty = false;
+        app->slots[cache_index].last_used = ++app->cache_clock;
+        flipchanger_summary_put(app, slot);  // Loaded rows are ground truth
+    } else {
+        // Failed read (binary store): no blank record may stand in for the slot, in the cache or
+        // the summary, or the next lookup would hit it and a save would overwrite the real one
+        app->slots[cache_index].slot_number = 0;
+        app->slots[cache_index].dirty = false;
+    }
+    free(slot);
+    return ok;
+}
+
+// Cache entry for slot_index, loading it on a miss (evicts the least recently used entry)
+static int32_t flipchanger_cache_fetch(FlipChangerApp* app, int32_t slot_index) {
+    flipchanger_cache_commit(app);
+    int32_t cache_index = flipchanger_cache_find(app, slot_index);
+    if(cache_index >= 0) {
+        app->cache_hits++;
+        app->slots[cache_index].last_used = ++app->cache_clock;
+        return cache_index;
+    }
+    app->cache_misses++;
+    if(!app->storage) return -1;
+    cache_index = flipchanger_cache_victim(app);
+    if(cache_index < 0 || !flipchanger_cache_load(app, cache_index, slot_index)) return -1;
+    return cache_index;
+}
+
+/* === Slot list prefetch - reads ahead of the cursor in the scroll direction while input is idle === */
+
+// Slots to read ahead, scaled to free heap (-1 = none, 0 = only the selected slot)
+static int32_t flipchanger_prefetch_depth(void) {
+    size_t free_heap = memmgr_get_free_heap();
+    if(free_heap < PREFETCH_HEAP_RESERVE) return -1;
+    size_t depth = (free_heap - PREFETCH_HEAP_RESERVE) / PREFETCH_HEAP_PER_SLOT;
+    return (depth > PREFETCH_MAX_DEPTH) ? PREFETCH_MAX_DEPTH : (int32_t)depth;
+}
+
+static bool flipchanger_storage_post(FlipChangerApp* app, StorageRequestType type, int32_t slot_index);
+
+// Slot list moved by step (+-1, or +-10 while a key repeats): restart read-ahead from the new position
+static void flipchanger_prefetch_note(FlipChangerApp* app, int32_t step) {
+    // An idle worker sleeps on its queue; a busy one polls while prefetch_step is set
+    if(app->prefetch_step == 0) flipchanger_storage_post(app, StorageRequestPrefetch, -1);
+    app->prefetch_step = step;
+    app->prefetch_done = 0;
+    app->prefetch_tick = furi_get_tick();
+}
+
+/**
+ * One unit of prefetch work, from the storage worker: once the list has been still for
+ * PREFETCH_IDLE_MS, read the selected slot, then the slots the next moves would land on.
+ * Not counted as cache hits or misses. Returns true while more work is pending.
+ */
+static bool flipchanger_prefetch_run(FlipChangerApp* app) {
+    if(app->prefetch_step == 0) return false;
+    if(app->current_view != VIEW_SLOT_LIST || !app->storage || app->prefetch_done > flipchanger_prefetch_depth()) {
+        app->prefetch_step = 0;
+        return false;
+    }
+    if(furi_get_tick() - app->prefetch_tick < PREFETCH_IDLE_MS) return true;
+
+    int32_t rows = flipchanger_list_rows(app);
+    if(rows <= 0) {
+        app->prefetch_step = 0;
+        return false;
+    }
+    int32_t row = (app->selected_index + app->prefetch_done * app->prefetch_step) % rows;
+    if(row < 0) row += rows;  // The list wraps both ways
+    int32_t slot_index = flipchanger_list_slot(app, row);
+    app->prefetch_done++;
+
+    flipchanger_cache_commit(app);
+    int32_t cache_index = flipchanger_cache_find(app, slot_index);
+    if(cache_index >= 0) {
+        app->slots[cache_index].last_used = ++app->cache_clock;  // Keep it ahead of eviction
+    } else {
+        cache_index = flipchanger_cache_victim(app);
+        if(cache_index >= 0) flipchanger_cache_load(app, cache_index, slot_index);
+    }
+    return true;
 }
 
-// Load slot from SD card into cache
+// Load slot from SD card into cache, replacing any cached copy (binary store: one seek + one record read)
 bool flipchanger_load_slot_from_sd(FlipChangerApp* app, int32_t slot_index) {
-    // For now, just reload all data (inefficient but works)
-    // TODO: Optimize to load individual slot
     if(slot_index < 0 || slot_index >= app->total_slots) {
         return false;
     }
     
-    // Reload entire file and find slot
-    // This is inefficient but safe - can optimize later
-    return flipchanger_load_data(app);
+    flipchanger_cache_commit(app);
+    int32_t cache_index = flipchanger_cache_find(app, slot_index);
+    if(cache_index >= 0) {
+        app->slots[cache_index].dirty = false;  // Reload discards the cached copy
+    } else {
+        cache_index = flipchanger_cache_victim(app);
+        if(cache_index < 0) return false;
+    }
+    return flipchanger_cache_load(app, cache_index, slot_index);
 }
 
-// Save slot to SD card
+// Save slot to SD card (binary store: one seek + one record write)
 bool flipchanger_save_slot_to_sd(FlipChangerApp* app, int32_t slot_index) {
-    // For now, save all cached slots (efficient enough for our use case)
-    // TODO: Optimize to update single slot in file
     if(slot_index < 0 || slot_index >= app->total_slots) {
         return false;
     }
     
-    // Save all cached slots to file
-    return flipchanger_save_data(app);
+    Slot* slot = flipchanger_get_slot(app, slot_index);
+    if(!slot) return flipchanger_save_data(app);
+    flipchanger_cache_commit(app);
+    flipchanger_tracks_flush(app);  // Edited track list goes to the track store, not the slot record
+    
+    // Other cached slots may still hold unsaved edits, so app->dirty stays set
+    bool ok = flipchanger_store_write_slot(app, slot);
+    int32_t cache_index = flipchanger_cache_find(app, slot_index);
+    if(ok && cache_index >= 0) app->slots[cache_index].dirty = false;
+    return ok;
 }
 
-// Get slot from cache or SD card
+/**
+ * Get slot from cache as a full record, for viewing or editing. This is the app's one
+ * open slot: edits to it stick, and it stays valid until another slot is opened or
+ * reloaded. The open slot is never evicted. NULL when not cached - flipchanger_lookup_slot
+ * queues the load without blocking.
+ */
 Slot* flipchanger_get_slot(FlipChangerApp* app, int32_t slot_index) {
     if(slot_index < 0 || slot_index >= app->total_slots) {
         return NULL;
     }
     
-    // Check if slot is in cache
-    int32_t cache_index = slot_index - app->cache_start_index;
-    if(cache_index >= 0 && cache_index < SLOT_CACHE_SIZE) {
-        return &app->slots[cache_index];
+    int32_t cache_index = flipchanger_cache_find(app, slot_index);
+    if(cache_index < 0) return NULL;
+    if(app->open_slot_index != slot_index) {
+        flipchanger_cache_commit(app);
+        flipchanger_cache_expand(&app->slots[cache_index], &app->open_slot);
+        app->open_slot_index = slot_index;
     }
-    
-    // Slot not in cache - try to load from SD card
-    // For now, return NULL (will implement SD loading)
-    // TODO: Load slot from SD card and update cache
-    return NULL;
+    app->slots[cache_index].last_used = ++app->cache_clock;
+    return &app->open_slot;
 }
 
-// Update cache to include requested slot (only call from input handler, not draw!)
-void flipchanger_update_cache(FlipChangerApp* app, int32_t slot_index) {
-    // Calculate new cache start
-    int32_t new_cache_start = slot_index - (SLOT_CACHE_SIZE / 2);
-    if(new_cache_start < 0) {
-        new_cache_start = 0;
+// Get a cached slot's compact record (read-only; NULL when not cached)
+const CachedSlot* flipchanger_get_cached_slot(FlipChangerApp* app, int32_t slot_index) {
+    if(slot_index < 0 || slot_index >= app->total_slots) {
+        return NULL;
     }
-    if(new_cache_start + SLOT_CACHE_SIZE > app->total_slots) {
-        new_cache_start = app->total_slots - SLOT_CACHE_SIZE;
-        if(new_cache_start < 0) {
-            new_cache_start = 0;
-        }
+    if(slot_index == app->open_slot_index) flipchanger_cache_commit(app);
+    int32_t cache_index = flipchanger_cache_find(app, slot_index);
+    return (cache_index >= 0) ? &app->slots[cache_index] : NULL;
+}
+
+/**
+ * Non-blocking lookup, safe from draw: the cached record, or Pending after queueing one
+ * LoadSlot request for the storage worker (its completion redraws). Never touches the SD card.
+ */
+SlotLookupState flipchanger_lookup_slot(FlipChangerApp* app, int32_t slot_index, const CachedSlot** slot_out) {
+    if(slot_out) *slot_out = NULL;
+    if(slot_index < 0 || slot_index >= app->total_slots) return SlotLookupInvalid;
+    const CachedSlot* slot = flipchanger_get_cached_slot(app, slot_index);
+    if(slot) {
+        if(slot_out) *slot_out = slot;
+        return SlotLookupReady;
     }
-    
-    // Only reload if cache needs to shift
-    if(new_cache_start != app->cache_start_index) {
-        // Save current cache if dirty (before reloading)
-        if(app->dirty && app->storage) {
-            flipchanger_save_data(app);
-        }
-        
-        // Reload data from SD card (this loads cached slots)
-        // TODO: Optimize to load only the new cache range
-        if(app->storage) {
-            flipchanger_load_data(app);
-        }
-        app->cache_start_index = new_cache_start;
-        
-        // Update slot numbers in cache
-        for(int32_t i = 0; i < SLOT_CACHE_SIZE && i < app->total_slots; i++) {
-            app->slots[i].slot_number = app->cache_start_index + i + 1;
-        }
+    uint8_t bit = 1 << (slot_index % 8);
+    if(!(app->load_pending[slot_index / 8] & bit) &&
+       flipchanger_storage_post(app, StorageRequestLoadSlot, slot_index)) {
+        app->load_pending[slot_index / 8] |= bit;  // Not set when the queue was full: next lookup retries
     }
+    return SlotLookupPending;
 }
 
-// Get slot status string (from cache or SD)
-const char* flipchanger_get_slot_status(FlipChangerApp* app, int32_t slot_index) {
-    Slot* slot = flipchanger_get_slot(app, slot_index);
-    if(!slot) {
-        // Not in cache, try to load
-        flipchanger_load_slot_from_sd(app, slot_index);
-        slot = flipchanger_get_slot(app, slot_index);
-        if(!slot) {
-            return "Empty";  // Default to empty if can't load
+// Get the loaded track list of a slot (NULL until flipchanger_load_tracks has read it)
+TrackList* flipchanger_get_tracks(FlipChangerApp* app, int32_t slot_index) {
+    if(slot_index < 0 || slot_index >= app->total_slots || slot_index != app->tracks_slot) {
+        return NULL;
+    }
+    return &app->tracks;
+}
+
+// Seconds in "m:ss" or "h:mm:ss" text; a bare number is seconds (as older builds stored them).
+// 0 when empty or not a duration, clamped to what a Track holds.
+uint16_t flipchanger_parse_duration(const char* text) {
+    uint32_t total = 0;
+    uint32_t part = 0;
+    int32_t digits = 0;
+    int32_t colons = 0;
+    for(; *text != '\0'; text++) {
+        if(*text >= '0' && *text <= '9') {
+            if(++digits > 5) return 0;
+            part = part * 10 + (uint32_t)(*text - '0');
+        } else if(*text == ':' && digits > 0 && colons < 2) {
+            total = (total + part) * 60;
+            part = 0;
+            digits = 0;
+            colons++;
+        } else if(*text != ' ') {
+            return 0;
         }
     }
+    total += part;
+    return (total < 0xFFFF) ? (uint16_t)total : 0xFFFF;
+}
+
+// "m:ss" (or "h:mm:ss" from an hour up) for display and export; empty for 0
+void flipchanger_format_duration(uint32_t seconds, char* out, size_t out_size) {
+    if(seconds == 0) {
+        out[0] = '\0';
+    } else if(seconds >= 3600) {
+        snprintf(out, out_size, "%lu:%02lu:%02lu", (unsigned long)(seconds / 3600), (unsigned long)(seconds / 60 % 60), (unsigned long)(seconds % 60));
+    } else {
+        snprintf(out, out_size, "%lu:%02lu", (unsigned long)(seconds / 60), (unsigned long)(seconds % 60));
+    }
+}
+
+// Duration entry: typed digits shift in from the right of m:ss (3, 34, 345 -> 3:45)
+static uint16_t flipchanger_duration_push_digit(uint16_t seconds, int32_t digit) {
+    uint32_t entry = ((uint32_t)seconds / 60 * 100 + seconds % 60) * 10 + (uint32_t)digit;
+    uint32_t total = entry / 100 * 60 + entry % 100;
+    return (total <= 0xFFFF) ? (uint16_t)total : seconds;
+}
+
+// Duration entry: drop the last digit typed
+static uint16_t flipchanger_duration_pop_digit(uint16_t seconds) {
+    uint32_t entry = ((uint32_t)seconds / 60 * 100 + seconds % 60) / 10;
+    return (uint16_t)(entry / 100 * 60 + entry % 100);
+}
+
+// Track list of slot edited: refresh the header's duration total and mark both for saving
+static void flipchanger_tracks_edited(FlipChangerApp* app, Slot* slot) {
+    slot->cd.total_seconds = 0;
+    for(int32_t t = 0; t < slot->cd.track_count && t < MAX_TRACKS; t++) {
+        slot->cd.total_seconds += app->tracks.tracks[t].seconds;
+    }
+    // The JSON slot object carries the track list, so the entry is dirty even if the header is not
+    int32_t cache_index = flipchanger_cache_find(app, slot->slot_number - 1);
+    if(cache_index >= 0) app->slots[cache_index].dirty = true;
+    app->tracks_dirty = true;
+    app->dirty = true;
+}
+
+// Make sure the requested slot is cached (storage worker only - may read the SD card)
+// A miss reads that one slot; the least recently used entry is written back if dirty.
+void flipchanger_update_cache(FlipChangerApp* app, int32_t slot_index) {
+    if(slot_index < 0 || slot_index >= app->total_slots) return;
+    flipchanger_cache_fetch(app, slot_index);
+}
+
+// Get slot status string (cache only; a miss queues the load and reads "Loading")
+const char* flipchanger_get_slot_status(FlipChangerApp* app, int32_t slot_index) {
+    const CachedSlot* slot;
+    SlotLookupState state = flipchanger_lookup_slot(app, slot_index, &slot);
+    if(state == SlotLookupPending) return "Loading";
+    if(state != SlotLookupReady) return "Empty";
     
     if(slot->occupied) {
-        return slot->cd.album;
+        static char album[MAX_ALBUM_LENGTH];  // Decoded copy, valid until the next call
+        flipchanger_unpack_string(slot->album, album, sizeof(album));
+        return album;
     }
     
     return "Empty";
 }
 
-// Count occupied slots (counts cached slots only - full count from SD card later)
+// Count occupied slots (from the slot summary, which covers every slot; read-only)
 int32_t flipchanger_count_occupied_slots(FlipChangerApp* app) {
     int32_t count = 0;
-    // Only count cached slots for now
-    // TODO: Count all slots from SD card
-    for(int32_t i = 0; i < SLOT_CACHE_SIZE && i < app->total_slots; i++) {
-        if(app->slots[i].occupied) {
+    for(int32_t i = 0; i < app->total_slots; i++) {
+        if(app->summary[i].occupied) {
             count++;
         }
     }
     return count;
 }
 
-/* === JSON helpers (lightweight parser - no external lib) === */
-static const char* skip_whitespace(const char* str) {
-    while(*str == ' ' || *str == '\t' || *str == '\n' || *str == '\r') {
-        str++;
+/* === Chunked JSON reader (small window refilled from SD - file size no longer limited by RAM) === */
+#define JSON_CHUNK_SIZE 256    // Read window; refilled from the file as parsing advances
+#define SLOT_JSON_MAX 4096     // Largest slot object we buffer (20 full tracks + notes fit easily)
+
+typedef struct {
+    File* file;        // NULL when reading text already in memory
+    const uint8_t* data;  // buf, or the caller's text
+    uint8_t buf[JSON_CHUNK_SIZE];
+    size_t len;        // Valid bytes in data
+    size_t pos;        // Next byte to consume
+    uint32_t base;     // File offset of data[0]
+} JsonReader;
+
+// Allocate reader on heap (keeps GUI/input stacks small)
+static JsonReader* json_reader_alloc(File* file) {
+    JsonReader* r = malloc(sizeof(JsonReader));
+    memset(r, 0, sizeof(JsonReader));
+    r->file = file;
+    r->data = r->buf;
+    return r;
+}
+
+// Reader over len bytes of text in memory (e.g. a buffered slot object); EOF at its end
+static JsonReader* json_reader_alloc_text(const char* text, size_t len) {
+    JsonReader* r = json_reader_alloc(NULL);
+    r->data = (const uint8_t*)text;
+    r->len = len;
+    return r;
+}
+
+// Peek next byte, refilling the window when exhausted. Returns -1 at EOF.
+static int json_reader_peek(JsonReader* r) {
+    if(r->pos >= r->len) {
+        if(!r->file) return -1;
+        r->base += r->len;
+        r->len = storage_file_read(r->file, r->buf, sizeof(r->buf));
+        r->pos = 0;
+        if(r->len == 0) return -1;
     }
-    return str;
+    return r->data[r->pos];
 }
 
-// Helper: Read string value from JSON
-static const char* read_json_string(const char* json, char* buffer, size_t buffer_size) {
-    const char* p = skip_whitespace(json);
-    if(*p != '"') return NULL;
-    p++;  // Skip opening quote
-    
+static int json_reader_next(JsonReader* r) {
+    int c = json_reader_peek(r);
+    if(c >= 0) r->pos++;
+    return c;
+}
+
+// Skip whitespace, return next non-space byte (not consumed) or -1
+static int json_reader_skip_ws(JsonReader* r) {
+    int c = json_reader_peek(r);
+    while(c == ' ' || c == '\t' || c == '\n' || c == '\r') {
+        r->pos++;
+        c = json_reader_peek(r);
+    }
+    return c;
+}
+
+// Consume expected byte after optional whitespace
+static bool json_reader_expect(JsonReader* r, char ch) {
+    if(json_reader_skip_ws(r) != ch) return false;
+    r->pos++;
+    return true;
+}
+
+// Move to a file offset (stays inside the current window when it already holds that byte)
+static bool json_reader_seek(JsonReader* r, uint32_t offset) {
+    if(offset >= r->base && offset < r->base + r->len) {
+        r->pos = offset - r->base;
+        return true;
+    }
+    if(!r->file) return false;
+    r->base = offset;
+    r->len = 0;
+    r->pos = 0;
+    return storage_file_seek(r->file, offset, true);
+}
+
+// Read quoted string (truncated to buffer_size - 1, rest consumed)
+static bool json_reader_read_string(JsonReader* r, char* buffer, size_t buffer_size) {
+    if(!json_reader_expect(r, '"')) return false;
     size_t i = 0;
-    while(*p && *p != '"' && i < buffer_size - 1) {
-        if(*p == '\\' && *(p + 1) == '"') {
-            buffer[i++] = '"';
-            p += 2;
-        } else {
-            buffer[i++] = *p++;
+    int c;
+    while((c = json_reader_next(r)) >= 0 && c != '"') {
+        if(c == '\\') {
+            c = json_reader_next(r);
+            if(c < 0) break;
         }
+        if(i < buffer_size - 1) buffer[i++] = (char)c;
     }
     buffer[i] = '\0';
-    
-    if(*p == '"') p++;  // Skip closing quote
-    return p;
+    return c == '"';
 }
 
-// Helper: Read integer value from JSON
-static const char* read_json_int(const char* json, int32_t* value) {
-    const char* p = skip_whitespace(json);
-    *value = 0;
+static bool json_reader_read_int(JsonReader* r, int32_t* value) {
+    int c = json_reader_skip_ws(r);
     bool negative = false;
-    
-    if(*p == '-') {
+    *value = 0;
+    if(c == '-') {
         negative = true;
-        p++;
+        r->pos++;
+        c = json_reader_peek(r);
     }
-    
-    while(*p >= '0' && *p <= '9') {
-        *value = *value * 10 + (*p - '0');
-        p++;
+    if(c < '0' || c > '9') return false;
+    while(c >= '0' && c <= '9') {
+        *value = *value * 10 + (c - '0');
+        r->pos++;
+        c = json_reader_peek(r);
     }
-    
     if(negative) *value = -(*value);
-    return p;
+    return true;
 }
 
-// Helper: Read boolean value from JSON
-static const char* read_json_bool(const char* json, bool* value) {
-    const char* p = skip_whitespace(json);
-    if(strncmp(p, "true", 4) == 0) {
-        *value = true;
-        return p + 4;
-    } else if(strncmp(p, "false", 5) == 0) {
-        *value = false;
-        return p + 5;
+// Copy (or skip when out == NULL) one complete value. Objects/arrays are matched by depth,
+// string contents are ignored for bracket counting. Output is truncated to out_size - 1.
+static size_t json_reader_copy_value(JsonReader* r, char* out, size_t out_size) {
+    size_t n = 0;
+    int depth = 0;
+    bool in_string = false;
+    int c = json_reader_skip_ws(r);
+    if(c < 0) return 0;
+
+    while((c = json_reader_peek(r)) >= 0) {
+        if(!in_string && depth == 0 && n > 0 && (c == ',' || c == '}' || c == ']')) break;
+        r->pos++;
+        if(out && n < out_size - 1) out[n] = (char)c;
+        n++;
+        if(in_string) {
+            if(c == '\\') {
+                c = json_reader_next(r);
+                if(c < 0) break;
+                if(out && n < out_size - 1) out[n] = (char)c;
+                n++;
+            } else if(c == '"') {
+                in_string = false;
+                if(depth == 0) break;
+            }
+        } else if(c == '"') {
+            in_string = true;
+        } else if(c == '{' || c == '[') {
+            depth++;
+        } else if(c == '}' || c == ']') {
+            depth--;
+            if(depth <= 0) break;
+        }
     }
-    return NULL;
+    if(out && out_size > 0) out[(n < out_size) ? n : out_size - 1] = '\0';
+    return n;
 }
 
-// Helper: Write JSON string (escape quotes) - forward decl, defined later
-static void write_json_string(File* file, const char* str);
+// Read next "key": of the current object. Returns false at '}' / EOF.
+static bool json_reader_next_key(JsonReader* r, char* key, size_t key_size) {
+    int c = json_reader_skip_ws(r);
+    if(c == ',') {
+        r->pos++;
+        c = json_reader_skip_ws(r);
+    }
+    if(c != '"') return false;
+    if(!json_reader_read_string(r, key, key_size)) return false;
+    return json_reader_expect(r, ':');
+}
 
-/* Character set for text input (Add/Edit Changer, CD fields). Index 39 = DEL. */
-static const char* CHAR_SET = "ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789 .-,";
-#define CHAR_DEL_INDEX ((int32_t)39)
+// Advance to next array element. Returns false at ']' / EOF.
+static bool json_reader_next_element(JsonReader* r) {
+    int c = json_reader_skip_ws(r);
+    if(c == ',') {
+        r->pos++;
+        c = json_reader_skip_ws(r);
+    }
+    if(c == ']') {
+        r->pos++;
+        return false;
+    }
+    return c >= 0;
+}
 
-// Helper: Find JSON key
-static const char* find_json_key(const char* json, const char* key) {
-    char key_pattern[64];
-    snprintf(key_pattern, sizeof(key_pattern), "\"%s\"", key);
-    const char* found = strstr(json, key_pattern);
-    if(!found) return NULL;
-    
-    const char* p = found + strlen(key_pattern);
-    p = skip_whitespace(p);
-    if(*p == ':') {
-        return p + 1;
+/* === Buffered JSON output - escape-aware appends into a memory buffer, or staged for a File === */
+#define JSON_WRITE_CHUNK 512   // File output is flushed in sector-sized writes
+
+typedef struct {
+    char* data;
+    size_t size;
+    size_t len;
+    bool overflow;          // Memory buffer ran out of room (file output never overflows)
+    File* file;             // NULL = memory only
+    uint32_t flushed;       // Bytes already handed to storage_file_write
+    uint32_t write_calls;   // storage_file_write calls issued
+    bool error;             // A write came up short
+} JsonBuf;
+
+// Memory buffer - e.g. a slot formatted first so its exact size is known
+static void json_buf_init(JsonBuf* out, char* data, size_t size) {
+    memset(out, 0, sizeof(JsonBuf));
+    out->data = data;
+    out->size = size;
+}
+
+// Staged file output; data must hold JSON_WRITE_CHUNK bytes
+static void json_buf_init_file(JsonBuf* out, File* file, char* data) {
+    json_buf_init(out, data, JSON_WRITE_CHUNK);
+    out->file = file;
+}
+
+static bool json_buf_flush(JsonBuf* out) {
+    if(out->file && out->len > 0) {
+        out->write_calls++;
+        if(storage_file_write(out->file, out->data, out->len) != out->len) out->error = true;
+        out->flushed += out->len;
+        out->len = 0;
+    }
+    return !out->error;
+}
+
+// Bytes emitted so far (for file output: offset of the next byte in the file)
+static uint32_t json_buf_offset(const JsonBuf* out) {
+    return out->flushed + out->len;
+}
+
+static void json_buf_append(JsonBuf* out, const char* str, size_t len) {
+    if(!out->file) {
+        if(out->len + len >= out->size) {
+            out->overflow = true;
+            return;
+        }
+        memcpy(out->data + out->len, str, len);
+        out->len += len;
+        return;
+    }
+    while(len > 0) {
+        if(out->len == out->size) json_buf_flush(out);
+        size_t n = out->size - out->len;
+        if(n > len) n = len;
+        memcpy(out->data + out->len, str, n);
+        out->len += n;
+        str += n;
+        len -= n;
+    }
+}
+
+static void json_buf_append_str(JsonBuf* out, const char* str) {
+    json_buf_append(out, str, strlen(str));
+}
+
+// Quoted, escaped string value (unescaped runs are copied in one go)
+static void json_buf_append_string(JsonBuf* out, const char* str) {
+    json_buf_append(out, "\"", 1);
+    const char* run = str;
+    for(const char* p = str; p && *p; p++) {
+        if(*p == '"' || *p == '\\') {
+            json_buf_append(out, run, p - run);
+            json_buf_append(out, "\\", 1);
+            run = p;  // Escaped char starts the next run
+        }
+    }
+    if(run) json_buf_append_str(out, run);
+    json_buf_append(out, "\"", 1);
+}
+
+/* === Changers registry === */
+
+// Make room for at least count changers (capacity doubles, capped at MAX_CHANGERS)
+static bool flipchanger_reserve_changers(FlipChangerApp* app, int32_t count) {
+    if(count > MAX_CHANGERS) return false;
+    if(count <= app->changer_capacity) return true;
+
+    int32_t capacity = app->changer_capacity > 0 ? app->changer_capacity : CHANGERS_INITIAL_CAPACITY;
+    while(capacity < count) capacity *= 2;
+    if(capacity > MAX_CHANGERS) capacity = MAX_CHANGERS;
+
+    Changer* grown = realloc(app->changers, capacity * sizeof(Changer));
+    if(!grown) return false;
+    memset(&grown[app->changer_capacity], 0, (capacity - app->changer_capacity) * sizeof(Changer));
+    app->changers = grown;
+    app->changer_capacity = capacity;
+    return true;
+}
+
+// Lowest free "changer_N" id - count-based ids would reuse a live file after a delete
+static void flipchanger_new_changer_id(const FlipChangerApp* app, char* id_out) {
+    for(int32_t n = 0;; n++) {
+        snprintf(id_out, CHANGER_ID_LEN, "changer_%ld", (long)n);
+        int32_t i = 0;
+        while(i < app->changer_count && strcmp(app->changers[i].id, id_out) != 0) i++;
+        if(i == app->changer_count) return;
     }
-    return NULL;
 }
 
 // Migrate from legacy single-file to Changer model
@@ -246,32 +927,34 @@ static bool flipchanger_migrate_from_legacy(FlipChangerApp* app) {
         return false;
     }
 
-    uint8_t buf[2048];
-    uint16_t n = storage_file_read(f, buf, sizeof(buf) - 1);
-    buf[n] = '\0';
-    storage_file_close(f);
-    storage_file_free(f);
-
+    // Only total_slots is needed from the header; the file itself is copied whole
     int32_t total_slots = DEFAULT_SLOTS;
-    const char* p = find_json_key((const char*)buf, "total_slots");
-    if(p) {
-        read_json_int(p, &total_slots);
-        if(total_slots < MIN_SLOTS || total_slots > MAX_SLOTS) total_slots = DEFAULT_SLOTS;
+    JsonReader* r = json_reader_alloc(f);
+    char key[24];
+    if(json_reader_expect(r, '{')) {
+        while(json_reader_next_key(r, key, sizeof(key))) {
+            if(strcmp(key, "total_slots") == 0) {
+                json_reader_read_int(r, &total_slots);
+                break;
+            }
+            json_reader_copy_value(r, NULL, 0);
+        }
     }
+    if(total_slots < MIN_SLOTS || total_slots > MAX_SLOTS) total_slots = DEFAULT_SLOTS;
+    free(r);
+    storage_file_close(f);
+    storage_file_free(f);
 
     storage_common_mkdir(app->storage, FLIPCHANGER_APP_DIR);
     char new_path[64];
     snprintf(new_path, sizeof(new_path), "%s/flipchanger_changer_0.json", FLIPCHANGER_APP_DIR);
 
-    File* out = storage_file_alloc(app->storage);
-    if(!storage_file_open(out, new_path, FSAM_WRITE, FSOM_CREATE_ALWAYS)) {
-        storage_file_free(out);
+    storage_common_remove(app->storage, new_path);
+    if(storage_common_copy(app->storage, FLIPCHANGER_DATA_PATH, new_path) != FSE_OK) {
         return false;
     }
-    storage_file_write(out, buf, n);
-    storage_file_close(out);
-    storage_file_free(out);
 
+    if(!flipchanger_reserve_changers(app, 1)) return false;
     Changer* c = &app->changers[0];
     strncpy(c->id, "changer_0", CHANGER_ID_LEN - 1);
     c->id[CHANGER_ID_LEN - 1] = '\0';
@@ -301,7 +984,36 @@ void flipchanger_get_slots_path(const FlipChangerApp* app, char* path_out, size_
     }
 }
 
-// Load changers registry from flipchanger_changers.json
+// Read one {"id":...,"name":...} registry entry; unknown keys are skipped
+static bool flipchanger_parse_changer(JsonReader* r, Changer* c) {
+    memset(c, 0, sizeof(Changer));
+    c->total_slots = DEFAULT_SLOTS;
+    if(!json_reader_expect(r, '{')) return false;
+
+    char key[16];
+    while(json_reader_next_key(r, key, sizeof(key))) {
+        if(strcmp(key, "id") == 0) {
+            json_reader_read_string(r, c->id, CHANGER_ID_LEN);
+        } else if(strcmp(key, "name") == 0) {
+            json_reader_read_string(r, c->name, CHANGER_NAME_LEN);
+        } else if(strcmp(key, "location") == 0) {
+            json_reader_read_string(r, c->location, CHANGER_LOCATION_LEN);
+        } else if(strcmp(key, "total_slots") == 0) {
+            int32_t ts = DEFAULT_SLOTS;
+            json_reader_read_int(r, &ts);
+            if(ts >= MIN_SLOTS && ts <= MAX_SLOTS) c->total_slots = ts;
+        } else {
+            json_reader_copy_value(r, NULL, 0);
+        }
+    }
+    return json_reader_expect(r, '}') && c->id[0] != '\0';
+}
+
+/**
+ * Load changers registry from flipchanger_changers.json.
+ * Streamed through the chunked reader, so stack use is constant and the registry
+ * is only bounded by MAX_CHANGERS. last_used_id may appear before or after the array.
+ */
 bool flipchanger_load_changers(FlipChangerApp* app) {
     if(!app || !app->storage) {
         return false;
@@ -310,7 +1022,6 @@ bool flipchanger_load_changers(FlipChangerApp* app) {
     app->changer_count = 0;
     app->current_changer_index = -1;
     app->current_changer_id[0] = '\0';
-    memset(app->changers, 0, sizeof(app->changers));
 
     File* file = storage_file_alloc(app->storage);
     if(!storage_file_open(file, FLIPCHANGER_CHANGERS_PATH, FSAM_READ, FSOM_OPEN_EXISTING)) {
@@ -321,74 +1032,45 @@ bool flipchanger_load_changers(FlipChangerApp* app) {
         return true;
     }
 
-    uint8_t buf[512];
-    uint16_t n = storage_file_read(file, buf, sizeof(buf) - 1);
-    buf[n] = '\0';
+    JsonReader* r = json_reader_alloc(file);
+    Changer entry;
+    char key[24];
+    if(json_reader_expect(r, '{')) {
+        while(json_reader_next_key(r, key, sizeof(key))) {
+            if(strcmp(key, "last_used_id") == 0) {
+                json_reader_read_string(r, app->current_changer_id, CHANGER_ID_LEN);
+            } else if(strcmp(key, "changers") == 0 && json_reader_skip_ws(r) == '[') {
+                r->pos++;
+                while(json_reader_next_element(r)) {
+                    if(json_reader_skip_ws(r) != '{') {
+                        json_reader_copy_value(r, NULL, 0);
+                        continue;
+                    }
+                    if(!flipchanger_parse_changer(r, &entry)) continue;
+                    if(!flipchanger_reserve_changers(app, app->changer_count + 1)) continue;  // Past MAX_CHANGERS
+                    memcpy(&app->changers[app->changer_count++], &entry, sizeof(Changer));
+                }
+            } else {
+                json_reader_copy_value(r, NULL, 0);
+            }
+        }
+    }
+    free(r);
     storage_file_close(file);
     storage_file_free(file);
 
-    const char* json = (const char*)buf;
-
-    const char* p = find_json_key(json, "last_used_id");
-    if(p) {
-        char last_id[CHANGER_ID_LEN];
-        if(read_json_string(p, last_id, sizeof(last_id))) {
-            strncpy(app->current_changer_id, last_id, CHANGER_ID_LEN - 1);
-            app->current_changer_id[CHANGER_ID_LEN - 1] = '\0';
+    for(int32_t i = 0; i < app->changer_count; i++) {
+        if(strcmp(app->changers[i].id, app->current_changer_id) == 0) {
+            app->current_changer_index = i;
+            break;
         }
     }
 
-    p = find_json_key(json, "changers");
-    if(!p) return true;
-    p = skip_whitespace(p);
-    if(*p != '[') return true;
-    p++;
-
-    int32_t i = 0;
-    while(*p && i < MAX_CHANGERS) {
-        p = skip_whitespace(p);
-        if(*p == ']') break;
-        if(*p != '{') {
-            p++;
-            continue;
-        }
-        p++;
-
-        Changer* c = &app->changers[i];
-        memset(c, 0, sizeof(Changer));
-        c->total_slots = DEFAULT_SLOTS;
-
-        const char* id_k = find_json_key(p, "id");
-        if(id_k) read_json_string(id_k, c->id, CHANGER_ID_LEN);
-        const char* name_k = find_json_key(p, "name");
-        if(name_k) read_json_string(name_k, c->name, CHANGER_NAME_LEN);
-        const char* loc_k = find_json_key(p, "location");
-        if(loc_k) read_json_string(loc_k, c->location, CHANGER_LOCATION_LEN);
-        const char* slots_k = find_json_key(p, "total_slots");
-        if(slots_k) {
-            int32_t ts = DEFAULT_SLOTS;
-            read_json_int(slots_k, &ts);
-            if(ts >= MIN_SLOTS && ts <= MAX_SLOTS) c->total_slots = ts;
-        }
-
-        if(c->id[0] != '\0') {
-            i++;
-            if(strcmp(c->id, app->current_changer_id) == 0) {
-                app->current_changer_index = i - 1;
-            }
-        }
-
-        while(*p && *p != '}' && *p != ']') p++;
-        if(*p == '}') p++;
-        if(*p == ',') p++;
-    }
-    app->changer_count = i;
-
-    if(app->changer_count > 0 && app->current_changer_index < 0) {
-        app->current_changer_index = 0;
-        strncpy(app->current_changer_id, app->changers[0].id, CHANGER_ID_LEN - 1);
-        app->current_changer_id[CHANGER_ID_LEN - 1] = '\0';
-    }
+    if(app->changer_count > 0 && app->current_changer_index < 0) {
+        app->current_changer_index = 0;
+        strncpy(app->current_changer_id, app->changers[0].id, CHANGER_ID_LEN - 1);
+        app->current_changer_id[CHANGER_ID_LEN - 1] = '\0';
+    }
 
     return true;
 }
@@ -407,367 +1089,3479 @@ bool flipchanger_save_changers(FlipChangerApp* app) {
         return false;
     }
 
-    char hdr[96];
-    snprintf(hdr, sizeof(hdr), "{\"version\":1,\"last_used_id\":");
-    storage_file_write(file, (const uint8_t*)hdr, strlen(hdr));
-    write_json_string(file, app->current_changer_id);
-    storage_file_write(file, (const uint8_t*)",\"changers\":[", 13);
+    JsonBuf out;
+    json_buf_init_file(&out, file, malloc(JSON_WRITE_CHUNK));
+    json_buf_append_str(&out, "{\"version\":1,\"last_used_id\":");
+    json_buf_append_string(&out, app->current_changer_id);
+    json_buf_append_str(&out, ",\"changers\":[");
 
     for(int32_t i = 0; i < app->changer_count; i++) {
-        if(i > 0) storage_file_write(file, (const uint8_t*)",", 1);
+        if(i > 0) json_buf_append(&out, ",", 1);
 
         Changer* c = &app->changers[i];
-        storage_file_write(file, (const uint8_t*)"{", 1);
-        storage_file_write(file, (const uint8_t*)"\"id\":", 5);
-        write_json_string(file, c->id);
-        storage_file_write(file, (const uint8_t*)",\"name\":", 8);
-        write_json_string(file, c->name);
-        storage_file_write(file, (const uint8_t*)",\"location\":", 12);
-        write_json_string(file, c->location);
+        json_buf_append_str(&out, "{\"id\":");
+        json_buf_append_string(&out, c->id);
+        json_buf_append_str(&out, ",\"name\":");
+        json_buf_append_string(&out, c->name);
+        json_buf_append_str(&out, ",\"location\":");
+        json_buf_append_string(&out, c->location);
         char slots[24];
         snprintf(slots, sizeof(slots), ",\"total_slots\":%ld}", (long)c->total_slots);
-        storage_file_write(file, (const uint8_t*)slots, strlen(slots));
+        json_buf_append_str(&out, slots);
     }
-    storage_file_write(file, (const uint8_t*)"]}", 2);
+    json_buf_append(&out, "]}", 2);
 
-    bool ok = storage_file_close(file);
+    bool ok = json_buf_flush(&out);
+    app->last_save_writes = out.write_calls;
+    free(out.data);
+    ok = storage_file_close(file) && ok;
     storage_file_free(file);
     return ok;
 }
 
-// Load data from JSON file (uses per-Changer path)
-bool flipchanger_load_data(FlipChangerApp* app) {
-    if(!app || !app->storage) {
-        return false;
+/* === Slot tokenizer: one forward pass, keys dispatched through a precomputed table === */
+typedef enum {
+    SlotKeySlot,
+    SlotKeyOccupied,
+    SlotKeyArtist,
+    SlotKeyAlbumArtist,
+    SlotKeyAlbum,
+    SlotKeyYear,
+    SlotKeyDiscNumber,
+    SlotKeyGenre,
+    SlotKeyTracks,
+    SlotKeyNotes,
+    SlotKeyNum,
+    SlotKeyTitle,
+    SlotKeyDuration,
+    SlotKeyCount,
+    SlotKeyUnknown = SlotKeyCount,
+} SlotKey;
+
+static const char* const SLOT_KEY_NAMES[SlotKeyCount] = {
+    "slot", "occupied", "artist", "album_artist", "album", "year",
+    "disc_number", "genre", "tracks", "notes", "num", "title", "duration",
+};
+
+#define JSON_KEY_HASH_INIT 2166136261u  // FNV-1a offset basis
+static uint32_t slot_key_hashes[SlotKeyCount];  // Filled on first use
+static bool slot_key_hashes_ready = false;
+
+static inline uint32_t json_key_hash_step(uint32_t hash, uint8_t c) {
+    return (hash ^ c) * 16777619u;
+}
+
+static SlotKey flipchanger_lookup_slot_key(const char* key, uint32_t hash) {
+    if(!slot_key_hashes_ready) {
+        for(int32_t i = 0; i < SlotKeyCount; i++) {
+            uint32_t h = JSON_KEY_HASH_INIT;
+            for(const char* c = SLOT_KEY_NAMES[i]; *c; c++) h = json_key_hash_step(h, (uint8_t)*c);
+            slot_key_hashes[i] = h;
+        }
+        slot_key_hashes_ready = true;
+    }
+    for(int32_t i = 0; i < SlotKeyCount; i++) {
+        if(slot_key_hashes[i] == hash && strcmp(SLOT_KEY_NAMES[i], key) == 0) return (SlotKey)i;
+    }
+    return SlotKeyUnknown;
+}
+
+// Read next "key": of the current object and resolve it in the key table (hash built while reading)
+static bool json_reader_next_slot_key(JsonReader* r, SlotKey* out) {
+    int c = json_reader_skip_ws(r);
+    if(c == ',') {
+        r->pos++;
+        c = json_reader_skip_ws(r);
     }
+    if(c != '"') return false;
+    r->pos++;
 
-    int32_t slots = DEFAULT_SLOTS;
-    if(app->current_changer_index >= 0 && app->current_changer_index < app->changer_count) {
-        slots = app->changers[app->current_changer_index].total_slots;
+    char key[16];
+    size_t i = 0;
+    uint32_t hash = JSON_KEY_HASH_INIT;
+    while((c = json_reader_next(r)) >= 0 && c != '"') {
+        if(c == '\\') c = json_reader_next(r);
+        if(c < 0) break;
+        hash = json_key_hash_step(hash, (uint8_t)c);
+        if(i < sizeof(key) - 1) key[i] = (char)c;
+        i++;
     }
-    flipchanger_init_slots(app, slots);
-    app->total_slots = slots;
+    if(c != '"' || !json_reader_expect(r, ':')) return false;
+    key[(i < sizeof(key)) ? i : sizeof(key) - 1] = '\0';
+    *out = (i < sizeof(key)) ? flipchanger_lookup_slot_key(key, hash) : SlotKeyUnknown;
+    return true;
+}
+
+static bool json_reader_read_bool(JsonReader* r, bool* value) {
+    char lit[8];
+    json_reader_copy_value(r, lit, sizeof(lit));
+    *value = (strncmp(lit, "true", 4) == 0);
+    return true;
+}
+
+// Skip the remaining keys of the current object including its closing '}'
+static void json_reader_skip_object_rest(JsonReader* r) {
+    char key[4];
+    while(json_reader_next_key(r, key, sizeof(key))) {
+        json_reader_copy_value(r, NULL, 0);
+    }
+    json_reader_expect(r, '}');
+}
+
+static void flipchanger_parse_track(JsonReader* r, Track* track) {
+    SlotKey key;
+    while(json_reader_next_slot_key(r, &key)) {
+        switch(key) {
+        case SlotKeyNum:
+            json_reader_read_int(r, &track->number);
+            break;
+        case SlotKeyTitle:
+            json_reader_read_string(r, track->title, MAX_TRACK_TITLE_LENGTH);
+            break;
+        case SlotKeyDuration: {
+            // "m:ss" text; a bare number is taken as seconds
+            char duration[16] = "";
+            int32_t seconds = 0;
+            if(json_reader_skip_ws(r) == '"') {
+                json_reader_read_string(r, duration, sizeof(duration));
+                track->seconds = flipchanger_parse_duration(duration);
+            } else if(json_reader_read_int(r, &seconds)) {
+                track->seconds = (seconds > 0) ? (uint16_t)((seconds < 0xFFFF) ? seconds : 0xFFFF) : 0;
+            } else {
+                json_reader_copy_value(r, NULL, 0);
+            }
+            break;
+        }
+        default:
+            json_reader_copy_value(r, NULL, 0);
+            break;
+        }
+    }
+    json_reader_expect(r, '}');
+}
+
+// Tracks array into tracks; with tracks NULL they are only counted and their durations totalled
+static void flipchanger_parse_tracks(JsonReader* r, CD* cd, TrackList* tracks) {
+    cd->track_count = 0;
+    cd->total_seconds = 0;
+    if(!json_reader_expect(r, '[')) {
+        json_reader_copy_value(r, NULL, 0);
+        return;
+    }
+    while(json_reader_next_element(r)) {
+        if(json_reader_skip_ws(r) != '{' || cd->track_count >= MAX_TRACKS) {
+            json_reader_copy_value(r, NULL, 0);
+            continue;
+        }
+        r->pos++;  // '{'
+        Track scratch;
+        Track* track = tracks ? &tracks->tracks[cd->track_count] : &scratch;
+        memset(track, 0, sizeof(Track));
+        track->number = cd->track_count + 1;
+        flipchanger_parse_track(r, track);
+        cd->total_seconds += track->seconds;
+        cd->track_count++;
+    }
+}
+
+/**
+ * Parse one slot object (reader positioned on its '{') into slot. If the "slot"
+ * key shows the object falls outside [keep_start, keep_end) the rest is skipped
+ * unparsed. Track titles are kept only when tracks is given (the cache holds none).
+ * Returns the 1-based slot number, or 0 if the object had none.
+ */
+static int32_t flipchanger_parse_slot(JsonReader* r, Slot* slot, TrackList* tracks, int32_t keep_start, int32_t keep_end) {
+    memset(slot, 0, sizeof(Slot));
+    if(tracks) memset(tracks, 0, sizeof(TrackList));
+    if(!json_reader_expect(r, '{')) return 0;
+
+    SlotKey key;
+    while(json_reader_next_slot_key(r, &key)) {
+        switch(key) {
+        case SlotKeySlot:
+            json_reader_read_int(r, &slot->slot_number);
+            if(slot->slot_number - 1 < keep_start || slot->slot_number - 1 >= keep_end) {
+                json_reader_skip_object_rest(r);
+                return slot->slot_number;
+            }
+            break;
+        case SlotKeyOccupied:
+            json_reader_read_bool(r, &slot->occupied);
+            break;
+        case SlotKeyArtist:
+            json_reader_read_string(r, slot->cd.artist, MAX_ARTIST_LENGTH);
+            break;
+        case SlotKeyAlbumArtist:
+            json_reader_read_string(r, slot->cd.album_artist, MAX_ARTIST_LENGTH);
+            break;
+        case SlotKeyAlbum:
+            json_reader_read_string(r, slot->cd.album, MAX_ALBUM_LENGTH);
+            break;
+        case SlotKeyYear:
+            json_reader_read_int(r, &slot->cd.year);
+            break;
+        case SlotKeyDiscNumber:
+            json_reader_read_int(r, &slot->cd.disc_number);
+            if(slot->cd.disc_number < 0) slot->cd.disc_number = 0;
+            break;
+        case SlotKeyGenre:
+            json_reader_read_string(r, slot->cd.genre, MAX_GENRE_LENGTH);
+            break;
+        case SlotKeyTracks:
+            flipchanger_parse_tracks(r, &slot->cd, tracks);
+            break;
+        case SlotKeyNotes:
+            json_reader_read_string(r, slot->cd.notes, MAX_NOTES_LENGTH);
+            break;
+        default:
+            json_reader_copy_value(r, NULL, 0);
+            break;
+        }
+    }
+    json_reader_expect(r, '}');
+
+    if(!slot->occupied) memset(&slot->cd, 0, sizeof(CD));
+    return slot->slot_number;
+}
 
+/* === Slot offset index (flipchanger_<id>.idx) - byte range of every slot object in the JSON === */
+#define SLOT_INDEX_ENTRIES_SIZE (MAX_SLOTS * sizeof(SlotIndexEntry))
+
+// Build path to offset index for current Changer (e.g. flipchanger_changer_0.idx)
+void flipchanger_get_index_path(const FlipChangerApp* app, char* path_out, size_t path_size) {
+    if(!app || !path_out || path_size < 32 || app->current_changer_id[0] == '\0') {
+        if(path_out && path_size > 0) path_out[0] = '\0';
+        return;
+    }
+    snprintf(path_out, path_size, "%s/flipchanger_%s.idx", FLIPCHANGER_APP_DIR, app->current_changer_id);
+}
+
+// Size and mtime of the JSON file - the index is only trusted while both still match
+static bool flipchanger_idx_stamp(FlipChangerApp* app, uint32_t* size, uint32_t* mtime) {
     char path[64];
     flipchanger_get_slots_path(app, path, sizeof(path));
-    if(path[0] == '\0') return true;
+    FileInfo info;
+    if(path[0] == '\0' || storage_common_stat(app->storage, path, &info) != FSE_OK) return false;
+    *size = (uint32_t)info.size;
+    return storage_common_timestamp(app->storage, path, mtime) == FSE_OK;
+}
+
+// Open the index and check it still describes the JSON file. NULL when missing or stale.
+static File* flipchanger_idx_open(FlipChangerApp* app, SlotIndexHeader* header) {
+    char path[64];
+    flipchanger_get_index_path(app, path, sizeof(path));
+    uint32_t size = 0, mtime = 0;
+    if(path[0] == '\0' || !flipchanger_idx_stamp(app, &size, &mtime)) return NULL;
 
     File* file = storage_file_alloc(app->storage);
     if(!storage_file_open(file, path, FSAM_READ, FSOM_OPEN_EXISTING)) {
         storage_file_free(file);
-        return true;
+        return NULL;
     }
-    
-    // Use static buffer to avoid stack overflow in nested callbacks (was 2KB on stack -> BusFault)
-    static uint8_t buffer[2048];
-    uint16_t bytes_read = storage_file_read(file, buffer, sizeof(buffer) - 1);
-    if(bytes_read >= sizeof(buffer) - 1) {
-        // File too large - truncate and warn (shouldn't happen with reasonable data)
-        bytes_read = sizeof(buffer) - 1;
+    bool ok = storage_file_read(file, header, sizeof(SlotIndexHeader)) == sizeof(SlotIndexHeader) &&
+              header->magic == SLOT_INDEX_MAGIC && header->version == SLOT_INDEX_VERSION &&
+              header->entry_count == MAX_SLOTS && header->json_size == size && header->json_mtime == mtime &&
+              header->total_slots >= MIN_SLOTS && header->total_slots <= MAX_SLOTS;
+    if(!ok) {
+        storage_file_close(file);
+        storage_file_free(file);
+        return NULL;
     }
-    buffer[bytes_read] = '\0';
-    
+    return file;
+}
+
+// Load header and every entry (one read). False when missing or stale.
+static bool flipchanger_idx_load(FlipChangerApp* app, SlotIndexHeader* header, SlotIndexEntry* entries) {
+    File* file = flipchanger_idx_open(app, header);
+    if(!file) return false;
+    bool ok = storage_file_read(file, entries, SLOT_INDEX_ENTRIES_SIZE) == SLOT_INDEX_ENTRIES_SIZE;
     storage_file_close(file);
     storage_file_free(file);
-    
-    // Parse JSON
-    const char* json = (const char*)buffer;
-    const char* p = json;
-    
-    // Find version (optional)
-    p = find_json_key(json, "version");
-    if(p) {
-        int32_t version = 0;
-        p = read_json_int(p, &version);
-        // Version handling (for future compatibility)
+    return ok;
+}
+
+// Write the index, stamped with the JSON file as it is now
+static bool flipchanger_idx_save(FlipChangerApp* app, SlotIndexHeader* header, const SlotIndexEntry* entries) {
+    char path[64];
+    flipchanger_get_index_path(app, path, sizeof(path));
+    if(path[0] == '\0' || !flipchanger_idx_stamp(app, &header->json_size, &header->json_mtime)) return false;
+    header->magic = SLOT_INDEX_MAGIC;
+    header->version = SLOT_INDEX_VERSION;
+    header->entry_count = MAX_SLOTS;
+
+    File* file = storage_file_alloc(app->storage);
+    bool ok = storage_file_open(file, path, FSAM_WRITE, FSOM_CREATE_ALWAYS) &&
+              storage_file_write(file, header, sizeof(SlotIndexHeader)) == sizeof(SlotIndexHeader) &&
+              storage_file_write(file, entries, SLOT_INDEX_ENTRIES_SIZE) == SLOT_INDEX_ENTRIES_SIZE;
+    ok = storage_file_close(file) && ok;
+    storage_file_free(file);
+    if(!ok) storage_common_remove(app->storage, path);  // Never leave a half-written index behind
+    return ok;
+}
+
+/**
+ * Read one slot object through the index: one entry read, then a seek straight to the
+ * object. Returns false (slot untouched) when the index is missing or stale - the
+ * caller then scans the whole file, which rebuilds it. A slot not in the file is empty.
+ */
+static bool flipchanger_idx_read_slot(FlipChangerApp* app, int32_t slot_index, Slot* slot) {
+    SlotIndexHeader header;
+    File* idx = flipchanger_idx_open(app, &header);
+    if(!idx) return false;
+
+    SlotIndexEntry entry;
+    bool ok = storage_file_seek(idx, sizeof(SlotIndexHeader) + slot_index * sizeof(SlotIndexEntry), true) &&
+              storage_file_read(idx, &entry, sizeof(entry)) == sizeof(entry);
+    storage_file_close(idx);
+    storage_file_free(idx);
+    if(!ok) return false;
+
+    memset(slot, 0, sizeof(Slot));
+    slot->slot_number = slot_index + 1;
+    if(entry.length == 0) return true;
+
+    char path[64];
+    flipchanger_get_slots_path(app, path, sizeof(path));
+    File* file = storage_file_alloc(app->storage);
+    if(!storage_file_open(file, path, FSAM_READ, FSOM_OPEN_EXISTING)) {
+        storage_file_free(file);
+        return false;
     }
-    
-    p = find_json_key(json, "total_slots");
-    if(p) {
-        int32_t total_slots = DEFAULT_SLOTS;
-        p = read_json_int(p, &total_slots);
-        if(total_slots >= MIN_SLOTS && total_slots <= MAX_SLOTS) {
-            app->total_slots = total_slots;
-            if(app->current_changer_index >= 0 && app->current_changer_index < app->changer_count) {
-                app->changers[app->current_changer_index].total_slots = total_slots;
+
+    JsonReader* r = json_reader_alloc(file);
+    if(json_reader_seek(r, entry.offset) && json_reader_skip_ws(r) == '{') {
+        int32_t parsed = flipchanger_parse_slot(r, slot, NULL, slot_index, slot_index + 1);
+        if(parsed != 0 && parsed != slot_index + 1) memset(slot, 0, sizeof(Slot));  // Positional objects carry no number
+    }
+    slot->slot_number = slot_index + 1;
+
+    free(r);
+    storage_file_close(file);
+    storage_file_free(file);
+    return true;
+}
+
+// Slot number of a buffered slot object ("slot" key, 1-based), or fallback when absent.
+// Negative means a tombstone left behind by an in-place update.
+static int32_t flipchanger_slot_object_number(const char* obj, int32_t fallback) {
+    JsonReader* r = json_reader_alloc_text(obj, strlen(obj));
+    int32_t slot_num = 0;
+    SlotKey key;
+    if(json_reader_expect(r, '{')) {
+        while(json_reader_next_slot_key(r, &key)) {
+            if(key == SlotKeySlot) {
+                json_reader_read_int(r, &slot_num);
+                break;
             }
+            json_reader_copy_value(r, NULL, 0);
         }
     }
-    
-    // Find slots array
-    p = find_json_key(json, "slots");
-    if(!p) {
-        // No slots array - use defaults
-        return true;
+    free(r);
+    return (slot_num != 0) ? slot_num : fallback;
+}
+
+/**
+ * Stream the current Changer's slots file, noting the byte range of every object,
+ * and save that as the offset index. If slot is given, slot_index is parsed into it
+ * on the way (left empty when the file has no such slot); every other slot is
+ * skipped as soon as its number is known.
+ */
+static bool flipchanger_read_slots_file(FlipChangerApp* app, int32_t slot_index, Slot* slot) {
+    if(slot) {
+        memset(slot, 0, sizeof(Slot));
+        slot->slot_number = slot_index + 1;
     }
-    
-    p = skip_whitespace(p);
-    if(*p != '[') {
-        return true;  // Invalid format
+
+    char path[64];
+    flipchanger_get_slots_path(app, path, sizeof(path));
+    if(path[0] == '\0') return true;
+
+    File* file = storage_file_alloc(app->storage);
+    if(!storage_file_open(file, path, FSAM_READ, FSOM_OPEN_EXISTING)) {
+        storage_file_free(file);
+        return true;
     }
-    p++;  // Skip '['
-    
-    // Parse slots (limited to what we can cache)
-    int32_t slot_index = 0;
-    while(*p && slot_index < SLOT_CACHE_SIZE && slot_index < app->total_slots) {
-        p = skip_whitespace(p);
-        if(*p == ']') break;  // End of array
-        if(*p != '{') {
-            p++;
-            continue;  // Skip invalid entry
-        }
-        p++;  // Skip '{'
-        
-        Slot* slot = &app->slots[slot_index];
-        slot->slot_number = slot_index + 1;
-        slot->occupied = false;
-        memset(&slot->cd, 0, sizeof(CD));
-        slot->cd.track_count = 0;
-        
-        // Parse slot number
-        const char* slot_key = find_json_key(p, "slot");
-        if(slot_key) {
-            int32_t slot_num = 0;
-            read_json_int(slot_key, &slot_num);
-            slot->slot_number = slot_num;
-        }
-        
-        // Parse occupied
-        const char* occ_key = find_json_key(p, "occupied");
-        if(occ_key) {
-            read_json_bool(occ_key, &slot->occupied);
-        }
-        
-        if(slot->occupied) {
-            const char* artist_key = find_json_key(p, "artist");
-            if(artist_key) {
-                read_json_string(artist_key, slot->cd.artist, MAX_ARTIST_LENGTH);
-            }
-            const char* album_artist_key = find_json_key(p, "album_artist");
-            if(album_artist_key) {
-                read_json_string(album_artist_key, slot->cd.album_artist, MAX_ARTIST_LENGTH);
-            }
-            const char* album_key = find_json_key(p, "album");
-            if(album_key) {
-                read_json_string(album_key, slot->cd.album, MAX_ALBUM_LENGTH);
-            }
-            
-            const char* year_key = find_json_key(p, "year");
-            if(year_key) {
-                read_json_int(year_key, &slot->cd.year);
-            }
-            const char* disc_key = find_json_key(p, "disc_number");
-            if(disc_key) {
-                read_json_int(disc_key, &slot->cd.disc_number);
-                if(slot->cd.disc_number < 0) slot->cd.disc_number = 0;
-            }
-            const char* genre_key = find_json_key(p, "genre");
-            if(genre_key) {
-                read_json_string(genre_key, slot->cd.genre, MAX_GENRE_LENGTH);
-            }
-            
-            // Parse tracks array (full parse - title, duration)
-            const char* tracks_key = find_json_key(p, "tracks");
-            if(tracks_key) {
-                const char* tracks_start = skip_whitespace(tracks_key);
-                if(*tracks_start == '[') {
-                    tracks_start++;
-                    int32_t track_count = 0;
-                    const char* track_p = tracks_start;
-                    
-                    while(*track_p && track_count < MAX_TRACKS) {
-                        track_p = skip_whitespace(track_p);
-                        if(*track_p == ']') break;
-                        if(*track_p == '{') {
-                            Track* track = &slot->cd.tracks[track_count];
-                            track->number = track_count + 1;
-                            track->title[0] = '\0';
-                            track->duration[0] = '\0';
-                            
-                            const char* title_key = find_json_key(track_p, "title");
-                            if(title_key) {
-                                read_json_string(title_key, track->title, MAX_TRACK_TITLE_LENGTH);
-                            }
-                            const char* dur_key = find_json_key(track_p, "duration");
-                            if(dur_key) {
-                                read_json_string(dur_key, track->duration, sizeof(track->duration) - 1);
-                            }
-                            const char* num_key = find_json_key(track_p, "num");
-                            if(num_key) {
-                                read_json_int(num_key, &track->number);
-                            }
-                            track_count++;
-                            while(*track_p && *track_p != '}') track_p++;
-                            if(*track_p == '}') track_p++;
-                        } else {
-                            track_p++;
-                        }
-                        if(*track_p == ',') track_p++;
+
+    JsonReader* r = json_reader_alloc(file);
+    Slot* scratch = malloc(sizeof(Slot));  // Parse target; copied out if it is the wanted slot
+    int32_t keep_start = slot ? slot_index : 0;
+    int32_t keep_end = slot ? slot_index + 1 : 0;
+    char key[24];
+    SlotIndexHeader index;
+    memset(&index, 0, sizeof(index));
+    SlotIndexEntry* entries = malloc(SLOT_INDEX_ENTRIES_SIZE);
+    memset(entries, 0, SLOT_INDEX_ENTRIES_SIZE);
+    bool found_array = false;
+    bool array_last = false;  // Appends before "]}" are only safe when nothing follows the array
+
+    if(json_reader_expect(r, '{')) {
+        while(json_reader_next_key(r, key, sizeof(key))) {
+            array_last = false;
+            if(strcmp(key, "total_slots") == 0) {
+                int32_t total_slots = DEFAULT_SLOTS;
+                json_reader_read_int(r, &total_slots);
+                if(total_slots >= MIN_SLOTS && total_slots <= MAX_SLOTS) {
+                    app->total_slots = total_slots;
+                    if(app->current_changer_index >= 0 && app->current_changer_index < app->changer_count) {
+                        app->changers[app->current_changer_index].total_slots = total_slots;
                     }
-                    slot->cd.track_count = track_count;
                 }
-            }
-            
-            // Parse notes
-            const char* notes_key = find_json_key(p, "notes");
-            if(notes_key) {
-                read_json_string(notes_key, slot->cd.notes, MAX_NOTES_LENGTH);
+            } else if(strcmp(key, "slots") == 0 && json_reader_expect(r, '[')) {
+                int32_t position = 0;
+                while(json_reader_next_element(r)) {
+                    position++;
+                    if(json_reader_skip_ws(r) != '{') {
+                        json_reader_copy_value(r, NULL, 0);  // Skip invalid entry
+                        continue;
+                    }
+                    uint32_t start = r->base + r->pos;
+                    int32_t slot_num = flipchanger_parse_slot(r, scratch, NULL, keep_start, keep_end);
+                    if(slot_num < 0) continue;  // Tombstone
+                    if(slot_num == 0) slot_num = position;
+                    if(slot_num <= MAX_SLOTS) {
+                        entries[slot_num - 1].offset = start;
+                        entries[slot_num - 1].length = r->base + r->pos - start;
+                    }
+                    if(slot && slot_num == slot_index + 1) {
+                        memcpy(slot, scratch, sizeof(Slot));
+                        slot->slot_number = slot_num;
+                    }
+                }
+                found_array = true;
+                array_last = true;
+                index.array_end = r->base + r->pos - 1;
+                index.element_count = position;
+            } else {
+                json_reader_copy_value(r, NULL, 0);  // version and unknown keys
             }
         }
-        
-        // Find next slot or end of array
-        while(*p && *p != '}' && *p != ']') p++;
-        if(*p == '}') p++;  // Skip '}'
-        if(*p == ',') p++;  // Skip ','
-        
-        slot_index++;
+        if(!array_last || !json_reader_expect(r, '}') || json_reader_skip_ws(r) >= 0) index.array_end = 0;
     }
-    
+
+    free(scratch);
+    free(r);
+    storage_file_close(file);
+    storage_file_free(file);
+
+    if(found_array) {
+        index.total_slots = app->total_slots;
+        flipchanger_idx_save(app, &index, entries);
+    }
+    free(entries);
     return true;
 }
 
-// Helper: Write JSON string (escape quotes)
-static void write_json_string(File* file, const char* str) {
-    if(!str || strlen(str) == 0) {
-        storage_file_write(file, (const uint8_t*)"\"\"", 2);
+// JSON store: take total_slots from the offset index, rebuilding it when missing or stale
+static void flipchanger_json_open_store(FlipChangerApp* app) {
+    SlotIndexHeader header;
+    File* idx = flipchanger_idx_open(app, &header);
+    if(!idx) {
+        flipchanger_read_slots_file(app, 0, NULL);
         return;
     }
-    
-    storage_file_write(file, (const uint8_t*)"\"", 1);
-    
-    const char* p = str;
-    while(*p) {
-        if(*p == '"' || *p == '\\') {
-            storage_file_write(file, (const uint8_t*)"\\", 1);
-        }
-        storage_file_write(file, (const uint8_t*)p, 1);
-        p++;
+    storage_file_close(idx);
+    storage_file_free(idx);
+    app->total_slots = header.total_slots;
+    if(app->current_changer_index >= 0 && app->current_changer_index < app->changer_count) {
+        app->changers[app->current_changer_index].total_slots = header.total_slots;
     }
-    
-    storage_file_write(file, (const uint8_t*)"\"", 1);
 }
 
-// Save data to JSON file (saves cached slots)
-bool flipchanger_save_data(FlipChangerApp* app) {
+// Load data from JSON file (uses per-Changer path)
+bool flipchanger_load_data(FlipChangerApp* app) {
     if(!app || !app->storage) {
         return false;
     }
+
+    int32_t slots = DEFAULT_SLOTS;
+    if(app->current_changer_index >= 0 && app->current_changer_index < app->changer_count) {
+        slots = app->changers[app->current_changer_index].total_slots;
+    }
+    flipchanger_init_slots(app, slots);
+    app->total_slots = slots;
+
+    app->json_export_stale = false;
+    flipchanger_terms_abort(app);
+    app->terms_valid = false;  // Nothing may restamp the new Changer's index before it is checked
+    app->catalog_column = -1;  // Nor its catalog column
+    app->binary_store = flipchanger_bin_open_store(app);
+    flipchanger_tracks_migrate(app);  // Before anything reads the track store
+    flipchanger_terms_load(app);
+    flipchanger_catalog_load(app);
+    memset(app->journal_slots, 0, sizeof(app->journal_slots));
+    if(!app->binary_store) {
+        // A journal left by a crash or a Changer switch is folded in now (drops a torn last record)
+        if(!flipchanger_journal_compact(app)) {
+            memset(app->journal_slots, 0xFF, sizeof(app->journal_slots));  // Kept: any slot may be in it
+        }
+    }
+    flipchanger_breakdown_reset(app);
+    flipchanger_summary_load(app);
+    if(!app->binary_store) flipchanger_json_open_store(app);
+    return true;  // Slots are read one at a time as they are used
+}
+
+// Format one slot object ({"slot":N,...}) into out; tracks holds its track list
+static void flipchanger_format_slot_json(const Slot* slot, const TrackList* tracks, JsonBuf* out) {
+    char num[48];
+    snprintf(num, sizeof(num), "{\"slot\":%ld,\"occupied\":%s", (long)slot->slot_number, slot->occupied ? "true" : "false");
+    json_buf_append_str(out, num);
     
-    // Note: Allow saving even if !running (needed for shutdown save)
-    
-    // Open file for writing
-    File* file = storage_file_alloc(app->storage);
-    if(!file) {
-        return false;
+    if(slot->occupied) {
+        json_buf_append_str(out, ",\"artist\":");
+        json_buf_append_string(out, slot->cd.artist);
+        json_buf_append_str(out, ",\"album_artist\":");
+        json_buf_append_string(out, slot->cd.album_artist);
+        json_buf_append_str(out, ",\"album\":");
+        json_buf_append_string(out, slot->cd.album);
+        snprintf(num, sizeof(num), ",\"year\":%ld,\"disc_number\":%ld", (long)slot->cd.year, (long)slot->cd.disc_number);
+        json_buf_append_str(out, num);
+        json_buf_append_str(out, ",\"genre\":");
+        json_buf_append_string(out, slot->cd.genre);
+        
+        // Tracks array
+        json_buf_append_str(out, ",\"tracks\":[");
+        for(int32_t t = 0; t < slot->cd.track_count && t < MAX_TRACKS; t++) {
+            snprintf(num, sizeof(num), "%s{\"num\":%ld,\"title\":", t > 0 ? "," : "", (long)tracks->tracks[t].number);
+            json_buf_append_str(out, num);
+            json_buf_append_string(out, tracks->tracks[t].title);
+            char duration[12];
+            flipchanger_format_duration(tracks->tracks[t].seconds, duration, sizeof(duration));
+            json_buf_append_str(out, ",\"duration\":");
+            json_buf_append_string(out, duration);
+            json_buf_append(out, "}", 1);
+        }
+        json_buf_append(out, "]", 1);
+        
+        // Notes
+        json_buf_append_str(out, ",\"notes\":");
+        json_buf_append_string(out, slot->cd.notes);
     }
     
+    json_buf_append(out, "}", 1);
+}
+
+/* Slots file writer - buffered output that notes each object's byte range for the offset index */
+typedef struct {
+    JsonBuf out;
+    SlotIndexHeader index;
+    SlotIndexEntry* entries;  // MAX_SLOTS entries
+} SlotsWriter;
+
+static void slots_writer_begin(SlotsWriter* w, File* file, int32_t total_slots) {
+    memset(w, 0, sizeof(SlotsWriter));
+    json_buf_init_file(&w->out, file, malloc(JSON_WRITE_CHUNK));
+    w->entries = malloc(SLOT_INDEX_ENTRIES_SIZE);
+    memset(w->entries, 0, SLOT_INDEX_ENTRIES_SIZE);
+    w->index.total_slots = total_slots;
+    char header[128];
+    snprintf(header, sizeof(header), "{\"version\":1,\"total_slots\":%ld,\"slots\":[", (long)total_slots);
+    json_buf_append_str(&w->out, header);
+}
+
+// Start an array element; returns its offset
+static uint32_t slots_writer_element(SlotsWriter* w) {
+    if(w->index.element_count > 0) json_buf_append(&w->out, ",", 1);
+    w->index.element_count++;
+    return json_buf_offset(&w->out);
+}
+
+static void slots_writer_note(SlotsWriter* w, int32_t slot_index, uint32_t start) {
+    if(slot_index >= 0 && slot_index < MAX_SLOTS) {
+        w->entries[slot_index].offset = start;
+        w->entries[slot_index].length = json_buf_offset(&w->out) - start;
+    }
+}
+
+// Append one already-serialized slot object to the array
+static void slots_writer_add(SlotsWriter* w, int32_t slot_index, const char* obj, size_t len) {
+    uint32_t start = slots_writer_element(w);
+    json_buf_append(&w->out, obj, len);
+    slots_writer_note(w, slot_index, start);
+}
+
+// Format one slot straight into the output
+static void flipchanger_write_slot_json(SlotsWriter* w, const Slot* slot, const TrackList* tracks) {
+    uint32_t start = slots_writer_element(w);
+    flipchanger_format_slot_json(slot, tracks, &w->out);
+    slots_writer_note(w, slot->slot_number - 1, start);
+}
+
+// Close the array and flush; false if any write came up short
+static bool slots_writer_end(SlotsWriter* w) {
+    w->index.array_end = json_buf_offset(&w->out);
+    json_buf_append(&w->out, "]}", 2);
+    bool ok = json_buf_flush(&w->out);
+    free(w->out.data);
+    return ok;
+}
+
+/**
+ * Rewrite the JSON slots file. With merge_cache, dirty cached slots are written from RAM;
+ * every other slot object is streamed across from the existing file, so the whole
+ * Changer survives even though only SLOT_CACHE_SIZE slots are ever in memory.
+ * Written to a temp file first, then renamed over the original.
+ */
+static bool flipchanger_write_slots_file(FlipChangerApp* app, bool merge_cache) {
     storage_common_mkdir(app->storage, FLIPCHANGER_APP_DIR);
 
     char path[64];
     flipchanger_get_slots_path(app, path, sizeof(path));
     if(path[0] == '\0') {
-        storage_file_free(file);
         return false;
     }
-    if(!storage_file_open(file, path, FSAM_WRITE, FSOM_CREATE_ALWAYS)) {
+    char tmp_path[72];
+    snprintf(tmp_path, sizeof(tmp_path), "%s.tmp", path);
+
+    // Open file for writing
+    File* file = storage_file_alloc(app->storage);
+    if(!storage_file_open(file, tmp_path, FSAM_WRITE, FSOM_CREATE_ALWAYS)) {
         storage_file_free(file);
         return false;
     }
     
     // Write JSON header
-    char header[128];
-    snprintf(header, sizeof(header), "{\"version\":1,\"total_slots\":%ld,\"slots\":[", (long)app->total_slots);
-    storage_file_write(file, (const uint8_t*)header, strlen(header));
+    SlotsWriter writer;
+    slots_writer_begin(&writer, file, app->total_slots);
     
-    // Write cached slots
-    bool first = true;
-    for(int32_t i = 0; i < SLOT_CACHE_SIZE && i < app->total_slots; i++) {
-        Slot* slot = &app->slots[i];
-        
-        if(!first) {
-            storage_file_write(file, (const uint8_t*)",", 1);
+    // Dirty entries in slot order (insertion sort - the cache is tiny)
+    int32_t merge[SLOT_CACHE_SIZE];
+    int32_t merge_count = 0;
+    uint8_t merged[(MAX_SLOTS + 7) / 8] = {0};  // Slots whose file copies the cache replaces
+    for(int32_t i = 0; merge_cache && i < SLOT_CACHE_SIZE; i++) {
+        if(!app->slots[i].dirty || app->slots[i].slot_number == 0) continue;
+        int32_t merged_index = app->slots[i].slot_number - 1;
+        if(merged_index < MAX_SLOTS) merged[merged_index / 8] |= (1 << (merged_index % 8));
+        int32_t j = merge_count++;
+        while(j > 0 && app->slots[merge[j - 1]].slot_number > app->slots[i].slot_number) {
+            merge[j] = merge[j - 1];
+            j--;
         }
-        first = false;
-        
-        storage_file_write(file, (const uint8_t*)"{", 1);
-        
-        // Slot number
-        char slot_num[32];
-        snprintf(slot_num, sizeof(slot_num), "\"slot\":%ld,", (long)slot->slot_number);
-        storage_file_write(file, (const uint8_t*)slot_num, strlen(slot_num));
-        
-        // Occupied
-        char occ_str[24];
-        snprintf(occ_str, sizeof(occ_str), "\"occupied\":%s,", slot->occupied ? "true" : "false");
-        storage_file_write(file, (const uint8_t*)occ_str, strlen(occ_str));
-        
+        merge[j] = i;
+    }
+    int32_t next_cached = 0;  // Next merge entry not yet written
+    TrackList* tracks = malloc(sizeof(TrackList));  // Cached slots carry no track titles
+    Slot* slot = malloc(sizeof(Slot));  // Cache entry expanded for formatting
+    bool read_ok = true;  // False if an old object could not be carried over - the old file is kept
+
+    // Merge: walk old slot objects in file order, interleaving cached slots by slot number
+    File* old_file = storage_file_alloc(app->storage);
+    if(storage_file_open(old_file, path, FSAM_READ, FSOM_OPEN_EXISTING)) {
+        JsonReader* r = json_reader_alloc(old_file);
+        char* obj = malloc(SLOT_JSON_MAX);
+        char key[24];
+
+        if(json_reader_expect(r, '{')) {
+            while(json_reader_next_key(r, key, sizeof(key))) {
+                if(strcmp(key, "slots") != 0 || !json_reader_expect(r, '[')) {
+                    json_reader_copy_value(r, NULL, 0);
+                    continue;
+                }
+                int32_t position = 0;
+                while(read_ok && json_reader_next_element(r)) {
+                    position++;
+                    if(json_reader_skip_ws(r) != '{') {
+                        json_reader_copy_value(r, NULL, 0);
+                        continue;
+                    }
+                    uint32_t start = r->base + r->pos;
+                    size_t len = json_reader_copy_value(r, obj, SLOT_JSON_MAX);
+                    int32_t slot_index = flipchanger_slot_object_number(obj, position) - 1;
+                    if(slot_index < 0) continue;  // Tombstone - dropped by the rewrite
+
+                    // Flush cached slots that sort before this one
+                    while(next_cached < merge_count && app->slots[merge[next_cached]].slot_number - 1 <= slot_index) {
+                        flipchanger_cache_expand(&app->slots[merge[next_cached]], slot);
+                        if(slot->occupied && slot->slot_number <= app->total_slots) {
+                            flipchanger_tracks_read(app, slot, tracks);
+                            flipchanger_write_slot_json(&writer, slot, tracks);
+                        }
+                        next_cached++;
+                    }
+                    // Cached copy wins over every file copy, including one moved out of slot order
+                    if(slot_index < MAX_SLOTS && (merged[slot_index / 8] & (1 << (slot_index % 8)))) continue;
+                    if(len >= SLOT_JSON_MAX) {
+                        // Oversized object (hand edit or import) does not fit the copy buffer:
+                        // parse it from the file again and write it back in our own layout
+                        read_ok = json_reader_seek(r, start);
+                        if(read_ok) {
+                            flipchanger_parse_slot(r, slot, tracks, 0, INT32_MAX);
+                            slot->slot_number = slot_index + 1;
+                            flipchanger_write_slot_json(&writer, slot, tracks);
+                        }
+                        continue;
+                    }
+
+                    slots_writer_add(&writer, slot_index, obj, len);
+                }
+            }
+        }
+
+        free(obj);
+        free(r);
+        storage_file_close(old_file);
+    }
+    storage_file_free(old_file);
+
+    // Remaining cached slots (after the last slot in the old file)
+    for(; next_cached < merge_count; next_cached++) {
+        flipchanger_cache_expand(&app->slots[merge[next_cached]], slot);
+        if(!slot->occupied || slot->slot_number > app->total_slots) continue;
+        flipchanger_tracks_read(app, slot, tracks);
+        flipchanger_write_slot_json(&writer, slot, tracks);
+    }
+    free(slot);
+    free(tracks);
+    
+    // Write JSON footer
+    bool result = slots_writer_end(&writer) && read_ok;
+    app->last_save_writes = writer.out.write_calls;
+    
+    result = storage_file_close(file) && result;
+    storage_file_free(file);
+    
+    if(result) {
+        storage_common_remove(app->storage, path);
+        result = (storage_common_rename(app->storage, tmp_path, path) == FSE_OK);
+    }
+    if(result) {
+        flipchanger_idx_save(app, &writer.index, writer.entries);
+    }
+    free(writer.entries);
+    
+    return result;
+}
+
+/**
+ * Save data to SD. JSON: the edit journal is folded into the file first (so no older
+ * journal record can be replayed over the slots written now), then cached slots are
+ * merged into a fresh copy of the file.
+ */
+bool flipchanger_save_data(FlipChangerApp* app) {
+    if(!app || !app->storage) {
+        return false;
+    }
+    
+    // Note: Allow saving even if !running (needed for shutdown save)
+    
+    flipchanger_cache_commit(app);
+    flipchanger_tracks_flush(app);
+    bool ok;
+    if(app->binary_store) {
+        ok = flipchanger_bin_write_dirty(app);
+    } else {
+        flipchanger_journal_compact(app);
+        ok = flipchanger_write_slots_file(app, true);
+    }
+    if(ok) {
+        for(int32_t i = 0; i < SLOT_CACHE_SIZE; i++) {
+            flipchanger_summary_put_cached(app, &app->slots[i]);
+            if(app->slots[i].dirty) {
+                flipchanger_terms_mark(app, app->slots[i].slot_number - 1);
+                flipchanger_catalog_put_cached(app, &app->slots[i]);
+            }
+            app->slots[i].dirty = false;
+        }
+        flipchanger_summary_save(app);
+        flipchanger_terms_restamp(app);
+        flipchanger_catalog_restamp(app);
+        app->dirty = false;
+    }
+    return ok;
+}
+
+#define JSON_TOMBSTONE "{\"slot\":-1}"
+#define JSON_TOMBSTONE_LEN (sizeof(JSON_TOMBSTONE) - 1)
+
+// Write text, then spaces out to width bytes so the object keeps its exact byte range
+// (buf is scratch of buf_size bytes holding len bytes of text; it is clobbered)
+static bool flipchanger_json_write_padded(File* file, char* buf, size_t buf_size, size_t len, size_t width) {
+    size_t chunk = (width < buf_size) ? width : buf_size;
+    memset(buf + len, ' ', chunk - len);
+    bool ok = storage_file_write(file, buf, chunk) == chunk;
+    memset(buf, ' ', buf_size);
+    for(size_t done = chunk; ok && done < width; done += chunk) {
+        chunk = (width - done < buf_size) ? width - done : buf_size;
+        ok = storage_file_write(file, buf, chunk) == chunk;
+    }
+    return ok;
+}
+
+/**
+ * Update one slot in the JSON file without rewriting the rest of it. The slot's
+ * object is located through the offset index (or, when that is stale, a scan
+ * with the streaming reader that rebuilds it); new text that fits the old byte
+ * range is written over it and padded with spaces. A slot that grew (or is new)
+ * is appended before the closing "]}" and its old object becomes a tombstone
+ * ({"slot":-1}), which readers skip and the next full save drops. Returns false
+ * without writing when the file is missing or its layout is not what we write.
+ */
+static bool flipchanger_json_update_slot(FlipChangerApp* app, const Slot* slot, const TrackList* tracks) {
+    int32_t slot_index = slot->slot_number - 1;
+    if(slot_index < 0 || slot_index >= MAX_SLOTS) return false;
+
+    char path[64];
+    flipchanger_get_slots_path(app, path, sizeof(path));
+    if(path[0] == '\0') return false;
+
+    File* file = storage_file_alloc(app->storage);
+    if(!storage_file_open(file, path, FSAM_READ_WRITE, FSOM_OPEN_EXISTING)) {
+        storage_file_free(file);
+        return false;
+    }
+
+    // Locate the slot's object and the array's closing ']'
+    JsonReader* r = json_reader_alloc(file);
+    char* obj = malloc(SLOT_JSON_MAX);
+    SlotIndexHeader index;
+    SlotIndexEntry* entries = malloc(SLOT_INDEX_ENTRIES_SIZE);
+    bool layout_ok = false;
+
+    // Index first - its ranges are checked against the file before anything is written through them
+    if(flipchanger_idx_load(app, &index, entries) && index.array_end > 0) {
+        SlotIndexEntry* entry = &entries[slot_index];
+        layout_ok = json_reader_seek(r, index.array_end) && json_reader_peek(r) == ']';
+        if(layout_ok && entry->length > 0) {
+            layout_ok = json_reader_seek(r, entry->offset) &&
+                        json_reader_copy_value(r, obj, SLOT_JSON_MAX) == entry->length && obj[0] == '{' &&
+                        flipchanger_slot_object_number(obj, slot->slot_number) == slot->slot_number;
+        }
+    }
+    if(!layout_ok) {
+        memset(&index, 0, sizeof(index));
+        memset(entries, 0, SLOT_INDEX_ENTRIES_SIZE);
+        char key[24];
+        bool found_array = false;
+        json_reader_seek(r, 0);
+        if(json_reader_expect(r, '{')) {
+            while(!found_array && json_reader_next_key(r, key, sizeof(key))) {
+                if(strcmp(key, "slots") != 0 || !json_reader_expect(r, '[')) {
+                    json_reader_copy_value(r, NULL, 0);
+                    continue;
+                }
+                found_array = true;
+                while(json_reader_next_element(r)) {
+                    index.element_count++;
+                    json_reader_skip_ws(r);
+                    uint32_t start = r->base + r->pos;
+                    size_t len = json_reader_copy_value(r, obj, SLOT_JSON_MAX);
+                    int32_t slot_num = flipchanger_slot_object_number(obj, index.element_count);
+                    if(obj[0] == '{' && slot_num > 0 && slot_num <= MAX_SLOTS) {
+                        entries[slot_num - 1].offset = start;  // Last copy wins, same as the reader
+                        entries[slot_num - 1].length = len;
+                    }
+                }
+                index.array_end = r->base + r->pos - 1;
+                // Only "}" and whitespace may follow, so appending before them is safe
+                layout_ok = json_reader_expect(r, '}') && json_reader_skip_ws(r) < 0;
+            }
+        }
+    }
+    free(r);
+    uint32_t obj_start = entries[slot_index].offset;
+    size_t obj_len = entries[slot_index].length;
+
+    // Formatted as ",{...}]}" so an append is a single write; the object is text.data + 1
+    JsonBuf text;
+    json_buf_init(&text, obj, SLOT_JSON_MAX);
+    json_buf_append(&text, ",", 1);
+    flipchanger_format_slot_json(slot, tracks, &text);
+    size_t slot_len = text.len - 1;
+    json_buf_append(&text, "]}", 2);
+
+    bool ok = true;
+    bool fallback = !layout_ok || text.overflow ||
+                    (obj_len > 0 && obj_len < JSON_TOMBSTONE_LEN && slot_len > obj_len);
+    if(!fallback && obj_len > 0 && slot_len <= obj_len) {
+        // Fits: overwrite in place
+        ok = storage_file_seek(file, obj_start, true) &&
+             flipchanger_json_write_padded(file, text.data + 1, text.size - 1, slot_len, obj_len);
+    } else if(!fallback && (slot->occupied || obj_len > 0)) {
+        // Grew or new: append, then tombstone the old copy
+        entries[slot_index].offset = 0;
+        entries[slot_index].length = 0;
         if(slot->occupied) {
-            storage_file_write(file, (const uint8_t*)"\"artist\":", 9);
-            write_json_string(file, slot->cd.artist);
-            storage_file_write(file, (const uint8_t*)",", 1);
-            storage_file_write(file, (const uint8_t*)"\"album_artist\":", 15);
-            write_json_string(file, slot->cd.album_artist);
-            storage_file_write(file, (const uint8_t*)",", 1);
-            storage_file_write(file, (const uint8_t*)"\"album\":", 8);
-            write_json_string(file, slot->cd.album);
-            storage_file_write(file, (const uint8_t*)",", 1);
-            
-            char year_str[32];
-            snprintf(year_str, sizeof(year_str), "\"year\":%ld,\"disc_number\":%ld,", (long)slot->cd.year, (long)slot->cd.disc_number);
-            storage_file_write(file, (const uint8_t*)year_str, strlen(year_str));
-            storage_file_write(file, (const uint8_t*)"\"genre\":", 8);
-            write_json_string(file, slot->cd.genre);
-            storage_file_write(file, (const uint8_t*)",", 1);
-            
-            // Tracks array
-            storage_file_write(file, (const uint8_t*)"\"tracks\":[", 10);
-            bool first_track = true;
-            for(int32_t t = 0; t < slot->cd.track_count && t < MAX_TRACKS; t++) {
-                if(!first_track) {
-                    storage_file_write(file, (const uint8_t*)",", 1);
+            size_t skip = (index.element_count > 0) ? 0 : 1;  // No comma in an empty array
+            ok = storage_file_seek(file, index.array_end, true) &&
+                 storage_file_write(file, text.data + skip, text.len - skip) == text.len - skip;
+            entries[slot_index].offset = index.array_end + 1 - skip;
+            entries[slot_index].length = slot_len;
+            index.array_end += text.len - skip - 2;
+            index.element_count++;
+        }
+        if(ok && obj_len > 0) {
+            memcpy(text.data, JSON_TOMBSTONE, JSON_TOMBSTONE_LEN);
+            ok = storage_file_seek(file, obj_start, true) &&
+                 flipchanger_json_write_padded(file, text.data, text.size, JSON_TOMBSTONE_LEN, obj_len);
+        }
+    }
+    free(obj);
+    ok = storage_file_close(file) && ok;
+    storage_file_free(file);
+
+    if(!fallback && ok) {
+        index.total_slots = app->total_slots;
+        flipchanger_idx_save(app, &index, entries);
+    }
+    free(entries);
+    return ok && !fallback;
+}
+
+/* === Edit journal (flipchanger_<id>.jnl) - one slot object per line, replayed over the JSON === */
+
+// Build path to edit journal for current Changer (e.g. flipchanger_changer_0.jnl)
+void flipchanger_get_journal_path(const FlipChangerApp* app, char* path_out, size_t path_size) {
+    if(!app || !path_out || path_size < 32 || app->current_changer_id[0] == '\0') {
+        if(path_out && path_size > 0) path_out[0] = '\0';
+        return;
+    }
+    snprintf(path_out, path_size, "%s/flipchanger_%s.jnl", FLIPCHANGER_APP_DIR, app->current_changer_id);
+}
+
+// Append one slot record (a single write). Returns the journal size afterwards, 0 on failure.
+static uint32_t flipchanger_journal_append(FlipChangerApp* app, const Slot* slot) {
+    char path[64];
+    flipchanger_get_journal_path(app, path, sizeof(path));
+    if(path[0] == '\0') return 0;
+
+    JsonBuf text;
+    json_buf_init(&text, malloc(SLOT_JSON_MAX), SLOT_JSON_MAX);
+    TrackList* tracks = malloc(sizeof(TrackList));
+    flipchanger_tracks_read(app, slot, tracks);
+    flipchanger_format_slot_json(slot, tracks, &text);
+    free(tracks);
+    json_buf_append(&text, "\n", 1);
+
+    uint32_t size = 0;
+    File* file = storage_file_alloc(app->storage);
+    if(!text.overflow && storage_file_open(file, path, FSAM_WRITE, FSOM_OPEN_APPEND)) {
+        if(storage_file_write(file, text.data, text.len) == text.len) {
+            size = storage_file_size(file);
+            int32_t slot_index = slot->slot_number - 1;
+            app->journal_slots[slot_index / 8] |= 1 << (slot_index % 8);
+        }
+        storage_file_close(file);
+    }
+    storage_file_free(file);
+    free(text.data);
+    return size;
+}
+
+// Read the next complete record into slot (and tracks, if given).
+// A torn last line (no '\n' after its '}') is ignored.
+static bool flipchanger_journal_next(JsonReader* r, Slot* slot, TrackList* tracks, int32_t keep_start, int32_t keep_end) {
+    while(json_reader_skip_ws(r) == '{') {
+        int32_t slot_num = flipchanger_parse_slot(r, slot, tracks, keep_start, keep_end);
+        if(json_reader_peek(r) != '\n') return false;
+        if(slot_num > 0 && slot_num <= MAX_SLOTS) return true;
+    }
+    return false;
+}
+
+// Overlay the journal's records for slot (later records win); skipped unless the slot has any
+static void flipchanger_journal_replay_slot(FlipChangerApp* app, Slot* slot) {
+    int32_t slot_index = slot->slot_number - 1;
+    if(!(app->journal_slots[slot_index / 8] & (1 << (slot_index % 8)))) return;
+    char path[64];
+    flipchanger_get_journal_path(app, path, sizeof(path));
+    if(path[0] == '\0') return;
+
+    File* file = storage_file_alloc(app->storage);
+    if(!storage_file_open(file, path, FSAM_READ, FSOM_OPEN_EXISTING)) {
+        storage_file_free(file);
+        return;
+    }
+    JsonReader* r = json_reader_alloc(file);
+    Slot* scratch = malloc(sizeof(Slot));
+    while(flipchanger_journal_next(r, scratch, NULL, slot_index, slot_index + 1)) {
+        if(scratch->slot_number == slot_index + 1) memcpy(slot, scratch, sizeof(Slot));
+    }
+    free(scratch);
+    free(r);
+    storage_file_close(file);
+    storage_file_free(file);
+}
+
+/**
+ * Fold the journal into the JSON slots file, one in-place slot update per record,
+ * then delete it. If the file's layout does not allow in-place updates it is
+ * rewritten once (without the cache) and the record retried. On failure the
+ * journal is kept, so every record is still replayed on the next load.
+ */
+bool flipchanger_journal_compact(FlipChangerApp* app) {
+    if(!app || !app->storage) return false;
+    char path[64];
+    flipchanger_get_journal_path(app, path, sizeof(path));
+    if(path[0] == '\0') return false;
+
+    File* file = storage_file_alloc(app->storage);
+    if(!storage_file_open(file, path, FSAM_READ, FSOM_OPEN_EXISTING)) {
+        storage_file_free(file);
+        return true;  // Nothing to fold in
+    }
+    bool summary_current = flipchanger_summary_current(app);  // Re-stamped below if so
+    JsonReader* r = json_reader_alloc(file);
+    Slot* scratch = malloc(sizeof(Slot));
+    TrackList* tracks = malloc(sizeof(TrackList));  // Records carry their track lists
+    bool ok = true;
+    bool rewritten = false;
+    while(ok && flipchanger_journal_next(r, scratch, tracks, 0, MAX_SLOTS)) {
+        ok = flipchanger_json_update_slot(app, scratch, tracks);
+        if(!ok && !rewritten) {
+            rewritten = true;
+            ok = flipchanger_write_slots_file(app, false) && flipchanger_json_update_slot(app, scratch, tracks);
+        }
+    }
+    free(tracks);
+    free(scratch);
+    free(r);
+    storage_file_close(file);
+    storage_file_free(file);
+
+    if(ok) {
+        storage_common_remove(app->storage, path);
+        memset(app->journal_slots, 0, sizeof(app->journal_slots));
+    }
+    if(summary_current) flipchanger_summary_restamp(app);
+    flipchanger_terms_restamp(app);  // Same slots, rewritten file
+    flipchanger_catalog_restamp(app);
+    return ok;
+}
+
+/* === Binary slot store (flipchanger_<id>.bin) - fixed-size records, O(1) seek per slot === */
+
+// Build path to binary store for current Changer (e.g. flipchanger_changer_0.bin)
+void flipchanger_get_store_path(const FlipChangerApp* app, char* path_out, size_t path_size) {
+    if(!app || !path_out || path_size < 32 || app->current_changer_id[0] == '\0') {
+        if(path_out && path_size > 0) path_out[0] = '\0';
+        return;
+    }
+    snprintf(path_out, path_size, "%s/flipchanger_%s.bin", FLIPCHANGER_APP_DIR, app->current_changer_id);
+}
+
+static uint32_t flipchanger_bin_offset(int32_t slot_index) {
+    return sizeof(SlotStoreHeader) + (uint32_t)slot_index * sizeof(Slot);
+}
+
+// Records come straight off the SD card - never trust lengths or terminators
+static void flipchanger_sanitize_slot(Slot* slot, int32_t slot_index) {
+    slot->slot_number = slot_index + 1;
+    if(!slot->occupied) {
+        memset(&slot->cd, 0, sizeof(CD));
+        return;
+    }
+    CD* cd = &slot->cd;
+    cd->artist[MAX_ARTIST_LENGTH - 1] = '\0';
+    cd->album_artist[MAX_ARTIST_LENGTH - 1] = '\0';
+    cd->album[MAX_ALBUM_LENGTH - 1] = '\0';
+    cd->genre[MAX_GENRE_LENGTH - 1] = '\0';
+    cd->notes[MAX_NOTES_LENGTH - 1] = '\0';
+    if(cd->track_count < 0) cd->track_count = 0;
+    if(cd->track_count > MAX_TRACKS) cd->track_count = MAX_TRACKS;
+    if(cd->total_seconds < 0) cd->total_seconds = 0;
+}
+
+static File* flipchanger_bin_open(FlipChangerApp* app, FS_AccessMode access, FS_OpenMode mode) {
+    char path[64];
+    flipchanger_get_store_path(app, path, sizeof(path));
+    if(path[0] == '\0') return NULL;
+    File* file = storage_file_alloc(app->storage);
+    if(!storage_file_open(file, path, access, mode)) {
+        storage_file_free(file);
+        return NULL;
+    }
+    return file;
+}
+
+static void flipchanger_bin_close(File* file) {
+    storage_file_close(file);
+    storage_file_free(file);
+}
+
+static bool flipchanger_bin_write_header(File* file, int32_t total_slots) {
+    SlotStoreHeader header = {
+        .magic = SLOT_STORE_MAGIC,
+        .version = SLOT_STORE_VERSION,
+        .header_size = sizeof(SlotStoreHeader),
+        .record_size = sizeof(Slot),
+        .total_slots = total_slots,
+    };
+    if(!storage_file_seek(file, 0, true)) return false;
+    return storage_file_write(file, &header, sizeof(header)) == sizeof(header);
+}
+
+// Append empty records until the file holds slot_count records
+static bool flipchanger_bin_extend(File* file, int32_t slot_count) {
+    uint64_t size = storage_file_size(file);
+    uint32_t wanted = flipchanger_bin_offset(slot_count);
+    if(size >= wanted) return true;
+    if(size < sizeof(SlotStoreHeader)) return false;
+
+    Slot* empty = malloc(sizeof(Slot));
+    memset(empty, 0, sizeof(Slot));
+    bool ok = storage_file_seek(file, size, true);
+    for(int32_t i = (size - sizeof(SlotStoreHeader)) / sizeof(Slot); ok && i < slot_count; i++) {
+        empty->slot_number = i + 1;
+        ok = storage_file_write(file, empty, sizeof(Slot)) == sizeof(Slot);
+    }
+    free(empty);
+    return ok;
+}
+
+/**
+ * Check flipchanger_<id>.bin exists and matches this build's record layout.
+ * A stale layout is rebuilt from the JSON file. Returns true if the store is usable.
+ */
+static bool flipchanger_bin_open_store(FlipChangerApp* app) {
+    File* file = flipchanger_bin_open(app, FSAM_READ, FSOM_OPEN_EXISTING);
+    if(!file) return false;
+
+    SlotStoreHeader header;
+    bool valid = storage_file_read(file, &header, sizeof(header)) == sizeof(header) &&
+                 header.magic == SLOT_STORE_MAGIC && header.version == SLOT_STORE_VERSION &&
+                 header.header_size == sizeof(SlotStoreHeader) && header.record_size == sizeof(Slot);
+    flipchanger_bin_close(file);
+
+    if(!valid) {
+        // Layout changed (or file damaged): JSON export is the source of truth
+        return flipchanger_set_binary_store(app, true);
+    }
+    // Store written after the last export (e.g. Changer switched before exit) - export again at exit
+    char json_path[64];
+    flipchanger_get_slots_path(app, json_path, sizeof(json_path));
+    char store_path[64];
+    flipchanger_get_store_path(app, store_path, sizeof(store_path));
+    uint32_t json_time = 0;
+    uint32_t store_time = 0;
+    if(storage_common_timestamp(app->storage, json_path, &json_time) != FSE_OK ||
+       (storage_common_timestamp(app->storage, store_path, &store_time) == FSE_OK && store_time > json_time)) {
+        app->json_export_stale = true;
+    }
+
+    if(header.total_slots >= MIN_SLOTS && header.total_slots <= MAX_SLOTS) {
+        app->total_slots = header.total_slots;
+        if(app->current_changer_index >= 0 && app->current_changer_index < app->changer_count) {
+            app->changers[app->current_changer_index].total_slots = header.total_slots;
+        }
+    }
+    return true;
+}
+
+// Read one record (seek + read of sizeof(Slot)). Missing records read as empty.
+static bool flipchanger_bin_read_slot(FlipChangerApp* app, int32_t slot_index, Slot* slot) {
+    File* file = flipchanger_bin_open(app, FSAM_READ, FSOM_OPEN_EXISTING);
+    memset(slot, 0, sizeof(Slot));
+    if(!file) {
+        flipchanger_sanitize_slot(slot, slot_index);
+        return false;
+    }
+    bool ok = storage_file_seek(file, flipchanger_bin_offset(slot_index), true);
+    if(ok && storage_file_read(file, slot, sizeof(Slot)) != sizeof(Slot)) {
+        memset(slot, 0, sizeof(Slot));
+    }
+    flipchanger_bin_close(file);
+    flipchanger_sanitize_slot(slot, slot_index);
+    return ok;
+}
+
+// Write one record in place (seek + write of sizeof(Slot))
+static bool flipchanger_bin_write_slot(FlipChangerApp* app, const Slot* slot) {
+    int32_t slot_index = slot->slot_number - 1;
+    if(slot_index < 0 || slot_index >= MAX_SLOTS) return false;
+
+    File* file = flipchanger_bin_open(app, FSAM_READ_WRITE, FSOM_OPEN_EXISTING);
+    if(!file) return false;
+    bool ok = flipchanger_bin_extend(file, slot_index) &&
+              storage_file_seek(file, flipchanger_bin_offset(slot_index), true) &&
+              storage_file_write(file, slot, sizeof(Slot)) == sizeof(Slot);
+    flipchanger_bin_close(file);
+    if(ok) app->json_export_stale = true;
+    return ok;
+}
+
+/**
+ * Write every dirty cache entry back and the header, through one open of the store
+ * (one seek + one record write per entry)
+ */
+static bool flipchanger_bin_write_dirty(FlipChangerApp* app) {
+    File* file = flipchanger_bin_open(app, FSAM_READ_WRITE, FSOM_OPEN_EXISTING);
+    if(!file) return false;
+
+    bool ok = flipchanger_bin_write_header(file, app->total_slots);
+    Slot* record = malloc(sizeof(Slot));  // Cache entry expanded back to a fixed-size record
+    for(int32_t i = 0; ok && i < SLOT_CACHE_SIZE; i++) {
+        const CachedSlot* cached = &app->slots[i];
+        int32_t slot_index = cached->slot_number - 1;
+        if(!cached->dirty || slot_index < 0 || slot_index >= app->total_slots) continue;
+        flipchanger_cache_expand(cached, record);
+        ok = flipchanger_bin_extend(file, slot_index) &&
+             storage_file_seek(file, flipchanger_bin_offset(slot_index), true) &&
+             storage_file_write(file, record, sizeof(Slot)) == sizeof(Slot);
+    }
+    free(record);
+    flipchanger_bin_close(file);
+    if(ok) app->json_export_stale = true;
+    return ok;
+}
+
+// Read one slot from the current store (JSON: index seek or scan, then its journal records)
+static bool flipchanger_read_slot(FlipChangerApp* app, int32_t slot_index, Slot* slot) {
+    if(app->binary_store) {
+        return flipchanger_bin_read_slot(app, slot_index, slot);
+    }
+    if(!flipchanger_idx_read_slot(app, slot_index, slot)) flipchanger_read_slots_file(app, slot_index, slot);
+    flipchanger_journal_replay_slot(app, slot);
+    return true;
+}
+
+/**
+ * Switch the current Changer between JSON and binary storage.
+ * Enable: build .bin from the JSON file (every record pre-sized, then parsed slots written by seek).
+ * Disable: export .bin to JSON and remove it.
+ */
+bool flipchanger_set_binary_store(FlipChangerApp* app, bool enable) {
+    if(!app || !app->storage) return false;
+    char store_path[64];
+    flipchanger_get_store_path(app, store_path, sizeof(store_path));
+    if(store_path[0] == '\0') return false;
+
+    // Same slots either way, so a current summary only needs re-stamping against the new store
+    bool summary_current;
+    if(!enable) {
+        if(app->binary_store) {
+            if(app->dirty) flipchanger_save_data(app);
+            summary_current = flipchanger_summary_current(app);
+            if(!flipchanger_export_json(app)) return false;
+        } else {
+            summary_current = flipchanger_summary_current(app);
+        }
+        storage_common_remove(app->storage, store_path);
+        app->binary_store = false;
+        if(summary_current) flipchanger_summary_restamp(app);
+        flipchanger_terms_restamp(app);
+        flipchanger_catalog_restamp(app);
+        return true;
+    }
+
+    // Cached edits and journal records go into the JSON file first so the import sees them
+    if(!app->binary_store) {
+        if(app->dirty) flipchanger_save_data(app);
+        else flipchanger_journal_compact(app);
+    }
+    summary_current = flipchanger_summary_current(app);
+
+    storage_common_mkdir(app->storage, FLIPCHANGER_APP_DIR);
+    File* file = flipchanger_bin_open(app, FSAM_READ_WRITE, FSOM_CREATE_ALWAYS);
+    if(!file) return false;
+    bool ok = flipchanger_bin_write_header(file, app->total_slots) &&
+              flipchanger_bin_extend(file, app->total_slots);
+
+    // Track lists are imported alongside (the JSON file is the source of truth here)
+    File* track_file = flipchanger_tracks_open(app, FSAM_READ_WRITE, FSOM_OPEN_ALWAYS);
+    ok = ok && track_file;
+
+    char json_path[64];
+    flipchanger_get_slots_path(app, json_path, sizeof(json_path));
+    File* json = storage_file_alloc(app->storage);
+    if(ok && storage_file_open(json, json_path, FSAM_READ, FSOM_OPEN_EXISTING)) {
+        JsonReader* r = json_reader_alloc(json);
+        Slot* slot = malloc(sizeof(Slot));
+        TrackList* tracks = malloc(sizeof(TrackList));
+        char key[24];
+        if(json_reader_expect(r, '{')) {
+            while(ok && json_reader_next_key(r, key, sizeof(key))) {
+                if(strcmp(key, "slots") != 0 || !json_reader_expect(r, '[')) {
+                    json_reader_copy_value(r, NULL, 0);
+                    continue;
+                }
+                int32_t position = 0;
+                while(ok && json_reader_next_element(r)) {
+                    position++;
+                    int32_t slot_num = flipchanger_parse_slot(r, slot, tracks, 0, MAX_SLOTS);
+                    if(slot_num < 0) continue;  // Tombstone
+                    if(slot_num == 0) slot_num = position;
+                    if(slot_num > MAX_SLOTS || !slot->occupied) continue;
+                    slot->slot_number = slot_num;
+                    ok = flipchanger_bin_extend(file, slot_num - 1) &&
+                         storage_file_seek(file, flipchanger_bin_offset(slot_num - 1), true) &&
+                         storage_file_write(file, slot, sizeof(Slot)) == sizeof(Slot);
+                    if(ok && slot->cd.track_count > 0) {
+                        ok = flipchanger_tracks_write_record(track_file, slot_num - 1, tracks);
+                    }
+                }
+            }
+        }
+        free(tracks);
+        free(slot);
+        free(r);
+        storage_file_close(json);
+    }
+    storage_file_free(json);
+    if(track_file) flipchanger_bin_close(track_file);
+    flipchanger_bin_close(file);
+
+    if(!ok) {
+        storage_common_remove(app->storage, store_path);
+        return false;
+    }
+    app->binary_store = true;
+    app->json_export_stale = false;
+    if(summary_current) flipchanger_summary_restamp(app);
+    flipchanger_terms_restamp(app);
+    flipchanger_catalog_restamp(app);
+    return true;
+}
+
+// Write every record of the binary store out as flipchanger_<id>.json (export format)
+bool flipchanger_export_json(FlipChangerApp* app) {
+    if(!app || !app->storage || !app->binary_store) return false;
+
+    File* bin = flipchanger_bin_open(app, FSAM_READ, FSOM_OPEN_EXISTING);
+    if(!bin) return false;
+
+    char path[64];
+    flipchanger_get_slots_path(app, path, sizeof(path));
+    char tmp_path[72];
+    snprintf(tmp_path, sizeof(tmp_path), "%s.tmp", path);
+    File* file = storage_file_alloc(app->storage);
+    if(!storage_file_open(file, tmp_path, FSAM_WRITE, FSOM_CREATE_ALWAYS)) {
+        storage_file_free(file);
+        flipchanger_bin_close(bin);
+        return false;
+    }
+
+    SlotsWriter writer;
+    slots_writer_begin(&writer, file, app->total_slots);
+
+    flipchanger_tracks_flush(app);
+    File* track_file = flipchanger_tracks_open(app, FSAM_READ, FSOM_OPEN_EXISTING);
+    Slot* slot = malloc(sizeof(Slot));
+    TrackList* tracks = malloc(sizeof(TrackList));
+    storage_file_seek(bin, sizeof(SlotStoreHeader), true);
+    for(int32_t i = 0; i < app->total_slots; i++) {
+        if(storage_file_read(bin, slot, sizeof(Slot)) != sizeof(Slot)) break;
+        flipchanger_sanitize_slot(slot, i);
+        if(!slot->occupied) continue;
+        memset(tracks, 0, sizeof(TrackList));
+        if(slot->cd.track_count > 0) flipchanger_tracks_read_record(track_file, i, tracks);
+        flipchanger_write_slot_json(&writer, slot, tracks);
+    }
+    free(tracks);
+    free(slot);
+    if(track_file) flipchanger_bin_close(track_file);
+    flipchanger_bin_close(bin);
+
+    bool ok = slots_writer_end(&writer);
+    app->last_save_writes = writer.out.write_calls;
+    ok = storage_file_close(file) && ok;
+    storage_file_free(file);
+    if(ok) {
+        storage_common_remove(app->storage, path);
+        ok = (storage_common_rename(app->storage, tmp_path, path) == FSE_OK);
+    }
+    if(ok) {
+        flipchanger_idx_save(app, &writer.index, writer.entries);
+        app->json_export_stale = false;
+    }
+    free(writer.entries);
+    return ok;
+}
+
+/* === Track store (flipchanger_<id>.trk) - one fixed-size track list per slot, read on demand === */
+
+// Build path to track store for current Changer (e.g. flipchanger_changer_0.trk)
+void flipchanger_get_tracks_path(const FlipChangerApp* app, char* path_out, size_t path_size) {
+    if(!app || !path_out || path_size < 32 || app->current_changer_id[0] == '\0') {
+        if(path_out && path_size > 0) path_out[0] = '\0';
+        return;
+    }
+    snprintf(path_out, path_size, "%s/flipchanger_%s.trk", FLIPCHANGER_APP_DIR, app->current_changer_id);
+}
+
+static uint32_t flipchanger_tracks_offset(int32_t slot_index) {
+    return sizeof(TrackStoreHeader) + (uint32_t)slot_index * sizeof(TrackList);
+}
+
+/**
+ * Open the track store and check its layout. Read access needs an existing file in this
+ * build's layout; write access starts a fresh (empty) store when the file is missing,
+ * damaged or laid out for another MAX_TRACKS. NULL on failure.
+ */
+static File* flipchanger_tracks_open(FlipChangerApp* app, FS_AccessMode access, FS_OpenMode mode) {
+    char path[64];
+    flipchanger_get_tracks_path(app, path, sizeof(path));
+    if(path[0] == '\0') return NULL;
+    File* file = storage_file_alloc(app->storage);
+    if(!storage_file_open(file, path, access, mode)) {
+        storage_file_free(file);
+        return NULL;
+    }
+
+    TrackStoreHeader header;
+    bool valid = storage_file_read(file, &header, sizeof(header)) == sizeof(header) &&
+                 header.magic == TRACK_STORE_MAGIC && header.version == TRACK_STORE_VERSION &&
+                 header.header_size == sizeof(TrackStoreHeader) && header.record_size == sizeof(TrackList);
+    if(!valid && access != FSAM_READ) {
+        storage_file_close(file);
+        header.magic = TRACK_STORE_MAGIC;
+        header.version = TRACK_STORE_VERSION;
+        header.header_size = sizeof(TrackStoreHeader);
+        header.record_size = sizeof(TrackList);
+        valid = storage_file_open(file, path, FSAM_READ_WRITE, FSOM_CREATE_ALWAYS) &&
+                storage_file_write(file, &header, sizeof(header)) == sizeof(header);
+    }
+    if(!valid) {
+        storage_file_close(file);
+        storage_file_free(file);
+        return NULL;
+    }
+    return file;
+}
+
+// Read one slot's record (seek + read of sizeof(TrackList)). Missing records read as empty.
+static bool flipchanger_tracks_read_record(File* file, int32_t slot_index, TrackList* tracks) {
+    memset(tracks, 0, sizeof(TrackList));
+    if(!file) return false;
+    bool ok = storage_file_seek(file, flipchanger_tracks_offset(slot_index), true);
+    if(ok && storage_file_read(file, tracks, sizeof(TrackList)) != sizeof(TrackList)) {
+        memset(tracks, 0, sizeof(TrackList));
+    }
+    for(int32_t t = 0; t < MAX_TRACKS; t++) {
+        tracks->tracks[t].title[MAX_TRACK_TITLE_LENGTH - 1] = '\0';
+    }
+    return ok;
+}
+
+// Write one slot's record in place (seek + write of sizeof(TrackList))
+static bool flipchanger_tracks_write_record(File* file, int32_t slot_index, const TrackList* tracks) {
+    if(slot_index < 0 || slot_index >= MAX_SLOTS) return false;
+    return storage_file_seek(file, flipchanger_tracks_offset(slot_index), true) &&
+           storage_file_write(file, tracks, sizeof(TrackList)) == sizeof(TrackList);
+}
+
+// A slot's track list: the loaded copy when it belongs to this slot, else its record
+static bool flipchanger_tracks_read(FlipChangerApp* app, const Slot* slot, TrackList* tracks) {
+    int32_t slot_index = slot->slot_number - 1;
+    if(slot_index == app->tracks_slot) {
+        if(tracks != &app->tracks) memcpy(tracks, &app->tracks, sizeof(TrackList));
+        return true;
+    }
+    memset(tracks, 0, sizeof(TrackList));
+    if(!slot->occupied || slot->cd.track_count <= 0) return true;  // Nothing to read
+
+    File* file = flipchanger_tracks_open(app, FSAM_READ, FSOM_OPEN_EXISTING);
+    bool ok = flipchanger_tracks_read_record(file, slot_index, tracks);
+    if(file) flipchanger_bin_close(file);
+    return ok;
+}
+
+// Write the loaded track list back if it was edited
+static bool flipchanger_tracks_flush(FlipChangerApp* app) {
+    if(!app->tracks_dirty || app->tracks_slot < 0) return true;
+    File* file = flipchanger_tracks_open(app, FSAM_READ_WRITE, FSOM_OPEN_ALWAYS);
+    if(!file) return false;
+    bool ok = flipchanger_tracks_write_record(file, app->tracks_slot, &app->tracks);
+    flipchanger_bin_close(file);
+    if(ok) app->tracks_dirty = false;
+    return ok;
+}
+
+// Load a slot's track list into app->tracks for Track Management (one record read).
+// Unsaved edits to the previously loaded list are written back first.
+bool flipchanger_load_tracks(FlipChangerApp* app, int32_t slot_index) {
+    if(!app || !app->storage) return false;
+    if(slot_index == app->tracks_slot) return true;
+    flipchanger_update_cache(app, slot_index);
+    Slot* slot = flipchanger_get_slot(app, slot_index);
+    if(!slot) return false;
+
+    flipchanger_tracks_flush(app);
+    app->tracks_slot = -1;
+    bool ok = flipchanger_tracks_read(app, slot, &app->tracks);
+    app->tracks_slot = slot_index;
+    app->tracks_dirty = false;
+    return ok;
+}
+
+// True when the track store exists in this build's layout
+static bool flipchanger_tracks_valid(FlipChangerApp* app) {
+    File* file = flipchanger_tracks_open(app, FSAM_READ, FSOM_OPEN_EXISTING);
+    if(!file) return false;
+    flipchanger_bin_close(file);
+    return true;
+}
+
+// Track record of track store version 1, when durations were kept as text
+typedef struct {
+    int32_t number;
+    char title[MAX_TRACK_TITLE_LENGTH];
+    char duration[16];
+} TrackV1;
+
+/**
+ * Convert a version 1 track store (text durations) to this build's layout through a
+ * temporary file, parsing each duration once. Older builds totalled album runtimes
+ * from those strings with atoi, so in binary mode each slot record's total is
+ * corrected as well (the summary rebuilds from it; in JSON mode it re-parses the file).
+ */
+static void flipchanger_tracks_migrate(FlipChangerApp* app) {
+    char path[64];
+    flipchanger_get_tracks_path(app, path, sizeof(path));
+    if(path[0] == '\0') return;
+    File* old_file = storage_file_alloc(app->storage);
+    TrackStoreHeader header;
+    bool legacy = storage_file_open(old_file, path, FSAM_READ, FSOM_OPEN_EXISTING) &&
+                  storage_file_read(old_file, &header, sizeof(header)) == sizeof(header) &&
+                  header.magic == TRACK_STORE_MAGIC && header.version == 1 &&
+                  header.header_size == sizeof(TrackStoreHeader) &&
+                  header.record_size == sizeof(TrackV1) * MAX_TRACKS;
+    if(!legacy) {
+        storage_file_close(old_file);
+        storage_file_free(old_file);
+        return;
+    }
+
+    char tmp_path[72];
+    snprintf(tmp_path, sizeof(tmp_path), "%s.tmp", path);
+    File* new_file = storage_file_alloc(app->storage);
+    header.version = TRACK_STORE_VERSION;
+    header.record_size = sizeof(TrackList);
+    bool ok = storage_file_open(new_file, tmp_path, FSAM_WRITE, FSOM_CREATE_ALWAYS) &&
+              storage_file_write(new_file, &header, sizeof(header)) == sizeof(header);
+    File* bin = app->binary_store ? flipchanger_bin_open(app, FSAM_READ_WRITE, FSOM_OPEN_EXISTING) : NULL;
+
+    TrackV1* old_tracks = malloc(sizeof(TrackV1) * MAX_TRACKS);
+    TrackList* tracks = malloc(sizeof(TrackList));
+    Slot* slot = bin ? malloc(sizeof(Slot)) : NULL;
+    for(int32_t i = 0; ok && i < MAX_SLOTS; i++) {
+        size_t got = storage_file_read(old_file, old_tracks, sizeof(TrackV1) * MAX_TRACKS);
+        if(got != sizeof(TrackV1) * MAX_TRACKS) break;  // Records past the end read as empty anyway
+        memset(tracks, 0, sizeof(TrackList));
+        int32_t total_seconds = 0;
+        for(int32_t t = 0; t < MAX_TRACKS; t++) {
+            old_tracks[t].duration[sizeof(old_tracks[t].duration) - 1] = '\0';
+            tracks->tracks[t].number = old_tracks[t].number;
+            memcpy(tracks->tracks[t].title, old_tracks[t].title, MAX_TRACK_TITLE_LENGTH);
+            tracks->tracks[t].seconds = flipchanger_parse_duration(old_tracks[t].duration);
+        }
+        ok = storage_file_write(new_file, tracks, sizeof(TrackList)) == sizeof(TrackList);
+
+        if(slot && storage_file_seek(bin, flipchanger_bin_offset(i), true) &&
+           storage_file_read(bin, slot, sizeof(Slot)) == sizeof(Slot) && slot->occupied) {
+            for(int32_t t = 0; t < slot->cd.track_count && t < MAX_TRACKS; t++) {
+                total_seconds += tracks->tracks[t].seconds;
+            }
+            if(slot->cd.total_seconds != total_seconds) {
+                slot->cd.total_seconds = total_seconds;
+                storage_file_seek(bin, flipchanger_bin_offset(i), true);
+                storage_file_write(bin, slot, sizeof(Slot));
+            }
+        }
+    }
+    free(slot);
+    free(tracks);
+    free(old_tracks);
+    if(bin) flipchanger_bin_close(bin);
+    storage_file_close(old_file);
+    storage_file_free(old_file);
+    ok = storage_file_close(new_file) && ok;
+    storage_file_free(new_file);
+    if(ok) {
+        storage_common_remove(app->storage, path);
+        ok = (storage_common_rename(app->storage, tmp_path, path) == FSE_OK);
+    }
+    if(!ok) storage_common_remove(app->storage, tmp_path);
+}
+
+/* === Slot list navigation - sort orders (artist, album, year, genre) and free slots === */
+
+// Case-insensitive, leading spaces skipped; "" sorts after any text
+static int32_t flipchanger_sort_text(const char* a, const char* b) {
+    while(*a == ' ') a++;
+    while(*b == ' ') b++;
+    if(*a == '\0' || *b == '\0') return (*a == '\0') - (*b == '\0');
+    for(;; a++, b++) {
+        char ca = (*a >= 'a' && *a <= 'z') ? (char)(*a - 'a' + 'A') : *a;
+        char cb = (*b >= 'a' && *b <= 'z') ? (char)(*b - 'a' + 'A') : *b;
+        if(ca != cb || ca == '\0') return (int32_t)(uint8_t)ca - (int32_t)(uint8_t)cb;
+    }
+}
+
+// Order of two rows in a sorted mode; the slot number breaks ties, so no two rows are equal
+static int32_t flipchanger_sort_compare(
+    uint8_t mode, const SlotSummary* a, int32_t a_slot, const SlotSummary* b, int32_t b_slot) {
+    int32_t result = 0;
+    if(mode == SortModeAlbum) {
+        result = flipchanger_sort_text(a->album, b->album);
+    } else if(mode == SortModeYear) {
+        if(a->year != b->year) result = (a->year == 0) ? 1 : (b->year == 0) ? -1 : (int32_t)a->year - (int32_t)b->year;
+    } else if(mode == SortModeGenre) {
+        result = flipchanger_sort_text(a->genre, b->genre);
+    }
+    if(result == 0) result = flipchanger_sort_text(a->artist, b->artist);
+    if(result == 0) result = flipchanger_sort_text(a->album, b->album);
+    return (result != 0) ? result : a_slot - b_slot;
+}
+
+/**
+ * Row slot_index changed from old_row (now in app->summary): take the slot out of each order
+ * it sorted differently in, and insert it again at the position found by binary search.
+ * O(log n) comparisons and one memmove of at most MAX_SLOTS bytes per order.
+ */
+static void flipchanger_sort_update(FlipChangerApp* app, int32_t slot_index, const SlotSummary* old_row) {
+    const SlotSummary* row = &app->summary[slot_index];
+    SlotSortOrders* sort = &app->sort;
+    int32_t count = sort->count;
+    for(uint8_t mode = SortModeArtist; mode < SortModeCount; mode++) {
+        uint8_t* order = sort->orders[mode - 1];
+        int32_t remaining = count;
+        if(old_row->occupied) {
+            if(row->occupied && flipchanger_sort_compare(mode, old_row, slot_index, row, slot_index) == 0) continue;
+            for(int32_t i = 0; i < count; i++) {
+                if(order[i] != slot_index) continue;
+                memmove(&order[i], &order[i + 1], count - i - 1);
+                remaining--;
+                break;
+            }
+        }
+        if(!row->occupied) continue;
+        int32_t low = 0;
+        int32_t high = remaining;
+        while(low < high) {
+            int32_t mid = (low + high) / 2;
+            if(flipchanger_sort_compare(mode, &app->summary[order[mid]], order[mid], row, slot_index) < 0) {
+                low = mid + 1;
+            } else {
+                high = mid;
+            }
+        }
+        memmove(&order[low + 1], &order[low], remaining - low);
+        order[low] = (uint8_t)slot_index;
+    }
+    sort->count = count - (old_row->occupied ? 1 : 0) + (row->occupied ? 1 : 0);
+}
+
+// Loaded bitmap must flag exactly the occupied rows (anything else means a rebuild)
+static bool flipchanger_occupancy_valid(const FlipChangerApp* app) {
+    for(int32_t i = 0; i < MAX_SLOTS; i++) {
+        bool bit = (app->occupancy[i / 8] & (1 << (i % 8))) != 0;
+        if(bit != (app->summary[i].occupied != 0)) return false;
+    }
+    return true;
+}
+
+/**
+ * Nearest free slot after from (direction 1) or before it (-1), wrapping; -1 = every slot is
+ * occupied. Bytes of the occupancy bitmap that are all ones (8 occupied slots) are stepped over
+ * whole, so a full 200-slot Changer costs 25 byte tests.
+ */
+static int32_t flipchanger_find_free(const FlipChangerApp* app, int32_t from, int32_t direction) {
+    int32_t total = app->total_slots;
+    int32_t slot_index = from;
+    for(int32_t checked = 0; checked < total;) {
+        slot_index = (slot_index + direction + total) % total;
+        uint8_t byte = app->occupancy[slot_index / 8];
+        int32_t byte_start = slot_index - slot_index % 8;
+        bool at_byte_edge = (direction > 0) ? (slot_index % 8 == 0) : (slot_index % 8 == 7);
+        if(byte == 0xFF && at_byte_edge && byte_start + 8 <= total) {
+            slot_index += 7 * direction;  // Rest of the byte: all occupied
+            checked += 8;
+            continue;
+        }
+        if(!(byte & (1 << (slot_index % 8)))) return slot_index;
+        checked++;
+    }
+    return -1;
+}
+
+// Loaded orders must list exactly the occupied rows (anything else means a rebuild)
+static bool flipchanger_sort_valid(const FlipChangerApp* app) {
+    int32_t occupied = 0;
+    for(int32_t i = 0; i < MAX_SLOTS; i++) {
+        if(app->summary[i].occupied) occupied++;
+    }
+    if(app->sort.count != occupied) return false;
+    for(int32_t o = 0; o < SORT_ORDER_COUNT; o++) {
+        for(int32_t i = 0; i < occupied; i++) {
+            uint8_t slot_index = app->sort.orders[o][i];
+            if(slot_index >= MAX_SLOTS || !app->summary[slot_index].occupied) return false;
+        }
+    }
+    return true;
+}
+
+// Rows of the slot list in the current sort mode
+static int32_t flipchanger_list_rows(const FlipChangerApp* app) {
+    return (app->sort_mode == SortModeSlot) ? app->total_slots : app->sort.count;
+}
+
+// Slot shown on a slot list row (-1 = none)
+static int32_t flipchanger_list_slot(const FlipChangerApp* app, int32_t row) {
+    if(row < 0 || row >= flipchanger_list_rows(app)) return -1;
+    return (app->sort_mode == SortModeSlot) ? row : app->sort.orders[app->sort_mode - 1][row];
+}
+
+// Row that shows slot_index in the current sort mode (-1 = not listed)
+static int32_t flipchanger_list_row_of(const FlipChangerApp* app, int32_t slot_index) {
+    if(app->sort_mode == SortModeSlot) return (slot_index >= 0 && slot_index < app->total_slots) ? slot_index : -1;
+    for(int32_t row = 0; row < app->sort.count; row++) {
+        if(app->sort.orders[app->sort_mode - 1][row] == slot_index) return row;
+    }
+    return -1;
+}
+
+/* === Slot summary (flipchanger_<id>.sum) - occupied flag, year + artist/album/genre prefixes for every slot === */
+
+// Build path to slot summary for current Changer (e.g. flipchanger_changer_0.sum)
+void flipchanger_get_summary_path(const FlipChangerApp* app, char* path_out, size_t path_size) {
+    if(!app || !path_out || path_size < 32 || app->current_changer_id[0] == '\0') {
+        if(path_out && path_size > 0) path_out[0] = '\0';
+        return;
+    }
+    snprintf(path_out, path_size, "%s/flipchanger_%s.sum", FLIPCHANGER_APP_DIR, app->current_changer_id);
+}
+
+// Stamp of what the summary describes: the active slot store, plus the journal in JSON mode.
+// The collection totals and occupancy bitmap ride along in the same header write.
+static void flipchanger_summary_stamp(FlipChangerApp* app, SlotSummaryHeader* header) {
+    memset(header, 0, sizeof(SlotSummaryHeader));
+    header->magic = SLOT_SUMMARY_MAGIC;
+    header->version = SLOT_SUMMARY_VERSION;
+    header->entry_size = sizeof(SlotSummary);
+    header->stats = app->stats;
+    memcpy(header->occupancy, app->occupancy, sizeof(header->occupancy));
+
+    char path[64];
+    FileInfo info;
+    if(app->binary_store) {
+        flipchanger_get_store_path(app, path, sizeof(path));
+    } else {
+        flipchanger_get_journal_path(app, path, sizeof(path));
+        if(path[0] != '\0' && storage_common_stat(app->storage, path, &info) == FSE_OK) {
+            header->journal_size = (uint32_t)info.size;
+        }
+        flipchanger_get_slots_path(app, path, sizeof(path));
+    }
+    if(path[0] != '\0' && storage_common_stat(app->storage, path, &info) == FSE_OK) {
+        header->store_size = (uint32_t)info.size;
+        storage_common_timestamp(app->storage, path, &header->store_mtime);
+    }
+}
+
+static void flipchanger_summary_row(
+    bool occupied,
+    const char* artist,
+    const char* album,
+    const char* genre,
+    int32_t year,
+    int32_t track_count,
+    int32_t total_seconds,
+    SlotSummary* row) {
+    memset(row, 0, sizeof(SlotSummary));
+    if(!occupied) return;
+    row->occupied = 1;
+    row->track_count = (track_count > 0 && track_count <= MAX_TRACKS) ? (uint8_t)track_count : 0;
+    row->total_seconds = (total_seconds > 0) ? (uint16_t)((total_seconds < 0xFFFF) ? total_seconds : 0xFFFF) : 0;
+    row->year = (year > 0 && year <= 0xFFFF) ? (uint16_t)year : 0;
+    strncpy(row->artist, artist, SUMMARY_ARTIST_LEN - 1);
+    strncpy(row->album, album, SUMMARY_ALBUM_LEN - 1);
+    strncpy(row->genre, genre, SUMMARY_GENRE_LEN - 1);
+}
+
+// Replace a row, moving the collection totals by the difference (O(1) per saved or deleted CD),
+// its occupancy bit and the slot to its new place in the sort orders
+static void flipchanger_summary_set(FlipChangerApp* app, int32_t slot_index, const SlotSummary* row) {
+    SlotSummary* old = &app->summary[slot_index];
+    if(old->occupied) {
+        app->stats.albums--;
+        app->stats.tracks -= old->track_count;
+        app->stats.seconds -= old->total_seconds;
+    }
+    if(row->occupied) {
+        app->stats.albums++;
+        app->stats.tracks += row->track_count;
+        app->stats.seconds += row->total_seconds;
+    }
+    if(row->occupied) {
+        app->occupancy[slot_index / 8] |= (1 << (slot_index % 8));
+    } else {
+        app->occupancy[slot_index / 8] &= ~(1 << (slot_index % 8));
+    }
+    SlotSummary old_row = *old;
+    *old = *row;
+    flipchanger_sort_update(app, slot_index, &old_row);
+}
+
+// Copy a slot's row into the in-RAM summary
+static void flipchanger_summary_put(FlipChangerApp* app, const Slot* slot) {
+    int32_t slot_index = slot->slot_number - 1;
+    if(slot_index < 0 || slot_index >= MAX_SLOTS) return;
+    SlotSummary row;
+    flipchanger_summary_row(
+        slot->occupied,
+        slot->cd.artist,
+        slot->cd.album,
+        slot->cd.genre,
+        slot->cd.year,
+        slot->cd.track_count,
+        slot->cd.total_seconds,
+        &row);
+    flipchanger_summary_set(app, slot_index, &row);
+    flipchanger_breakdown_put(app, slot_index, slot->occupied, slot->cd.artist, slot->cd.genre, slot->cd.year);
+}
+
+// Row of a cached slot (only the prefixes are decoded)
+static void flipchanger_summary_row_cached(const CachedSlot* slot, SlotSummary* row) {
+    char artist[SUMMARY_ARTIST_LEN];
+    char album[SUMMARY_ALBUM_LEN];
+    char genre[SUMMARY_GENRE_LEN];
+    flipchanger_unpack_string(slot->artist, artist, sizeof(artist));
+    flipchanger_unpack_string(slot->album, album, sizeof(album));
+    flipchanger_unpack_string(slot->genre, genre, sizeof(genre));
+    flipchanger_summary_row(
+        slot->occupied, artist, album, genre, slot->year, slot->track_count, slot->total_seconds, row);
+}
+
+static void flipchanger_summary_put_cached(FlipChangerApp* app, const CachedSlot* slot) {
+    int32_t slot_index = slot->slot_number - 1;
+    if(slot_index < 0 || slot_index >= MAX_SLOTS) return;
+    SlotSummary row;
+    flipchanger_summary_row_cached(slot, &row);
+    flipchanger_summary_set(app, slot_index, &row);
+    flipchanger_breakdown_put_cached(app, slot);
+}
+
+// Write the whole summary (header + every row + sort orders)
+static bool flipchanger_summary_save(FlipChangerApp* app) {
+    char path[64];
+    flipchanger_get_summary_path(app, path, sizeof(path));
+    if(path[0] == '\0') return false;
+    SlotSummaryHeader header;
+    flipchanger_summary_stamp(app, &header);
+
+    File* file = storage_file_alloc(app->storage);
+    bool ok = storage_file_open(file, path, FSAM_WRITE, FSOM_CREATE_ALWAYS) &&
+              storage_file_write(file, &header, sizeof(header)) == sizeof(header) &&
+              storage_file_write(file, app->summary, sizeof(app->summary)) == sizeof(app->summary) &&
+              storage_file_write(file, &app->sort, sizeof(app->sort)) == sizeof(app->sort);
+    ok = storage_file_close(file) && ok;
+    storage_file_free(file);
+    if(!ok) storage_common_remove(app->storage, path);
+    return ok;
+}
+
+// Rewrite one row, the sort orders and the header stamp in place (whole file if it is missing)
+static bool flipchanger_summary_save_slot(FlipChangerApp* app, int32_t slot_index) {
+    char path[64];
+    flipchanger_get_summary_path(app, path, sizeof(path));
+    if(path[0] == '\0' || slot_index < 0 || slot_index >= MAX_SLOTS) return false;
+    SlotSummaryHeader header;
+    flipchanger_summary_stamp(app, &header);
+
+    File* file = storage_file_alloc(app->storage);
+    if(!storage_file_open(file, path, FSAM_READ_WRITE, FSOM_OPEN_EXISTING)) {
+        storage_file_free(file);
+        return flipchanger_summary_save(app);
+    }
+    bool ok = storage_file_seek(file, sizeof(header) + slot_index * sizeof(SlotSummary), true) &&
+              storage_file_write(file, &app->summary[slot_index], sizeof(SlotSummary)) == sizeof(SlotSummary) &&
+              storage_file_seek(file, sizeof(header) + sizeof(app->summary), true) &&
+              storage_file_write(file, &app->sort, sizeof(app->sort)) == sizeof(app->sort) &&
+              storage_file_seek(file, 0, true) &&
+              storage_file_write(file, &header, sizeof(header)) == sizeof(header);
+    ok = storage_file_close(file) && ok;
+    storage_file_free(file);
+    return ok;
+}
+
+// Read the file's header into header_out (optional); true when it still matches the slot store
+static bool flipchanger_summary_current_header(FlipChangerApp* app, SlotSummaryHeader* header_out) {
+    char path[64];
+    flipchanger_get_summary_path(app, path, sizeof(path));
+    if(path[0] == '\0') return false;
+    SlotSummaryHeader expected;
+    SlotSummaryHeader header;
+    flipchanger_summary_stamp(app, &expected);
+
+    File* file = storage_file_alloc(app->storage);
+    bool ok = storage_file_open(file, path, FSAM_READ, FSOM_OPEN_EXISTING) &&
+              storage_file_read(file, &header, sizeof(header)) == sizeof(header) &&
+              memcmp(&header, &expected, offsetof(SlotSummaryHeader, stats)) == 0;
+    storage_file_close(file);
+    storage_file_free(file);
+    if(ok && header_out) *header_out = header;
+    return ok;
+}
+
+static bool flipchanger_summary_current(FlipChangerApp* app) {
+    return flipchanger_summary_current_header(app, NULL);
+}
+
+// Store rewritten without changing any slot (journal folded in) - only the stamp moves.
+// The totals stay as written: this also runs before the summary is loaded.
+static void flipchanger_summary_restamp(FlipChangerApp* app) {
+    char path[64];
+    flipchanger_get_summary_path(app, path, sizeof(path));
+    if(path[0] == '\0') return;
+    SlotSummaryHeader header;
+    flipchanger_summary_stamp(app, &header);
+
+    File* file = storage_file_alloc(app->storage);
+    if(storage_file_open(file, path, FSAM_READ_WRITE, FSOM_OPEN_EXISTING)) {
+        storage_file_write(file, &header, offsetof(SlotSummaryHeader, stats));
+        storage_file_close(file);
+    }
+    storage_file_free(file);
+}
+
+/**
+ * Rebuild from the slot store: one pass over every slot (and the journal in JSON mode).
+ * In JSON mode the track store is rebuilt in the same pass; the binary store has no
+ * copy of the track lists, so there the track store is left as it is.
+ */
+static void flipchanger_summary_rebuild(FlipChangerApp* app) {
+    memset(app->summary, 0, sizeof(app->summary));
+    memset(&app->stats, 0, sizeof(app->stats));  // Summed again row by row below
+    memset(&app->sort, 0, sizeof(app->sort));    // Inserted again row by row below
+    memset(app->occupancy, 0, sizeof(app->occupancy));
+    Slot* slot = malloc(sizeof(Slot));
+
+    if(app->binary_store) {
+        File* file = flipchanger_bin_open(app, FSAM_READ, FSOM_OPEN_EXISTING);
+        if(file) {
+            storage_file_seek(file, sizeof(SlotStoreHeader), true);
+            for(int32_t i = 0; i < app->total_slots; i++) {
+                if(storage_file_read(file, slot, sizeof(Slot)) != sizeof(Slot)) break;
+                flipchanger_sanitize_slot(slot, i);
+                flipchanger_summary_put(app, slot);
+            }
+            flipchanger_bin_close(file);
+        }
+    } else {
+        TrackList* tracks = malloc(sizeof(TrackList));
+        File* track_file = flipchanger_tracks_open(app, FSAM_READ_WRITE, FSOM_CREATE_ALWAYS);
+        app->tracks_slot = -1;
+
+        char path[64];
+        flipchanger_get_slots_path(app, path, sizeof(path));
+        File* file = storage_file_alloc(app->storage);
+        if(storage_file_open(file, path, FSAM_READ, FSOM_OPEN_EXISTING)) {
+            JsonReader* r = json_reader_alloc(file);
+            char key[24];
+            if(json_reader_expect(r, '{')) {
+                while(json_reader_next_key(r, key, sizeof(key))) {
+                    if(strcmp(key, "slots") != 0 || !json_reader_expect(r, '[')) {
+                        json_reader_copy_value(r, NULL, 0);
+                        continue;
+                    }
+                    int32_t position = 0;
+                    while(json_reader_next_element(r)) {
+                        position++;
+                        if(json_reader_skip_ws(r) != '{') {
+                            json_reader_copy_value(r, NULL, 0);
+                            continue;
+                        }
+                        int32_t slot_num = flipchanger_parse_slot(r, slot, tracks, 0, MAX_SLOTS);
+                        if(slot_num < 0) continue;  // Tombstone
+                        slot->slot_number = (slot_num == 0) ? position : slot_num;
+                        flipchanger_summary_put(app, slot);
+                        if(track_file && slot->occupied && slot->cd.track_count > 0) {
+                            flipchanger_tracks_write_record(track_file, slot->slot_number - 1, tracks);
+                        }
+                    }
+                }
+            }
+            free(r);
+            storage_file_close(file);
+        }
+
+        flipchanger_get_journal_path(app, path, sizeof(path));
+        if(storage_file_open(file, path, FSAM_READ, FSOM_OPEN_EXISTING)) {
+            JsonReader* r = json_reader_alloc(file);
+            while(flipchanger_journal_next(r, slot, tracks, 0, MAX_SLOTS)) {
+                flipchanger_summary_put(app, slot);
+                if(track_file && slot->occupied && slot->cd.track_count > 0) {
+                    flipchanger_tracks_write_record(track_file, slot->slot_number - 1, tracks);
+                }
+            }
+            free(r);
+            storage_file_close(file);
+        }
+        storage_file_free(file);
+        if(track_file) flipchanger_bin_close(track_file);
+        free(tracks);
+    }
+
+    free(slot);
+    flipchanger_summary_save(app);
+}
+
+// Load the summary, collection totals and sort orders for the current Changer, rebuilding them
+// when missing or stale (or, in JSON mode, when the track store it is rebuilt alongside is
+// missing). Files from before the totals or sort orders existed, or totalled from text
+// durations, carry an older version, so they get one rebuild.
+static void flipchanger_summary_load(FlipChangerApp* app) {
+    char path[64];
+    flipchanger_get_summary_path(app, path, sizeof(path));
+    SlotSummaryHeader header;
+    bool ok = false;
+    if(path[0] != '\0' && flipchanger_summary_current_header(app, &header)) {
+        File* file = storage_file_alloc(app->storage);
+        ok = storage_file_open(file, path, FSAM_READ, FSOM_OPEN_EXISTING) &&
+             storage_file_seek(file, sizeof(SlotSummaryHeader), true) &&
+             storage_file_read(file, app->summary, sizeof(app->summary)) == sizeof(app->summary) &&
+             storage_file_read(file, &app->sort, sizeof(app->sort)) == sizeof(app->sort) &&
+             flipchanger_sort_valid(app);
+        storage_file_close(file);
+        storage_file_free(file);
+        app->stats = header.stats;
+        memcpy(app->occupancy, header.occupancy, sizeof(app->occupancy));
+        ok = ok && flipchanger_occupancy_valid(app);
+    }
+    if(!ok || (!app->binary_store && !flipchanger_tracks_valid(app))) flipchanger_summary_rebuild(app);
+}
+
+/* === Statistics breakdown - top artists/genres (Space-Saving tables) and a decade histogram === */
+
+// Key of a CD field (statistics tables, catalog): upper-cased prefix without surrounding spaces ("" = none)
+static void flipchanger_normalize_key(const char* text, char* key, size_t key_size) {
+    while(*text == ' ') text++;
+    size_t len = 0;
+    for(; text[len] != '\0' && len < key_size - 1; len++) {
+        char c = text[len];
+        key[len] = (c >= 'a' && c <= 'z') ? (char)(c - 'a' + 'A') : c;
+    }
+    while(len > 0 && key[len - 1] == ' ') len--;
+    key[len] = '\0';
+}
+
+/**
+ * Count key once and return its counter. When the table is full, a new key takes over the
+ * smallest counter; slots counted there lose their reference, as the count is now the new key's.
+ */
+static uint8_t flipchanger_breakdown_add(StatsCounter* table, uint8_t* slot_counters, const char* key) {
+    int32_t smallest = 0;
+    for(int32_t i = 0; i < STATS_TOP_KEYS; i++) {
+        if(table[i].count > 0 && strcmp(table[i].key, key) == 0) {
+            table[i].count++;
+            return (uint8_t)i;
+        }
+        if(table[i].count < table[smallest].count) smallest = i;
+    }
+    for(int32_t i = 0; i < MAX_SLOTS; i++) {
+        if(slot_counters[i] == smallest) slot_counters[i] = STATS_NO_COUNTER;
+    }
+    StatsCounter* counter = &table[smallest];
+    counter->error = counter->count;
+    strncpy(counter->key, key, STATS_KEY_LEN - 1);
+    counter->key[STATS_KEY_LEN - 1] = '\0';
+    counter->count++;
+    return (uint8_t)smallest;
+}
+
+// Move one slot's count in a table to key ("" = uncount); unchanged keys keep their counter
+static void flipchanger_breakdown_move(StatsCounter* table, uint8_t* slot_counters, int32_t slot_index, const char* key) {
+    uint8_t counted = slot_counters[slot_index];
+    if(counted != STATS_NO_COUNTER) {
+        StatsCounter* counter = &table[counted];
+        if(strcmp(counter->key, key) == 0) return;
+        counter->count--;
+        if(counter->error > counter->count) counter->error = counter->count;
+        slot_counters[slot_index] = STATS_NO_COUNTER;
+    }
+    if(key[0] != '\0') slot_counters[slot_index] = flipchanger_breakdown_add(table, slot_counters, key);
+}
+
+/**
+ * Move one slot's contribution from what it counted before to its current values.
+ * Called wherever a summary row changes (save, delete, write-back), so the breakdown
+ * follows edits without another pass. Slots the pass has not reached yet are skipped.
+ */
+static void flipchanger_breakdown_put(
+    FlipChangerApp* app, int32_t slot_index, bool occupied, const char* artist, const char* genre, int32_t year) {
+    CollectionBreakdown* breakdown = app->breakdown;
+    if(!breakdown || slot_index < 0 || slot_index >= breakdown->scanned) return;
+
+    char artist_key[STATS_KEY_LEN];
+    char genre_key[STATS_KEY_LEN];
+    flipchanger_normalize_key(occupied ? artist : "", artist_key, sizeof(artist_key));
+    flipchanger_normalize_key(occupied ? genre : "", genre_key, sizeof(genre_key));
+    uint8_t decade = (occupied && year >= 1900 && year < 1900 + STATS_DECADES * 10) ? (uint8_t)((year - 1900) / 10) :
+                                                                                     STATS_NO_DECADE;
+
+    flipchanger_breakdown_move(breakdown->artists, breakdown->slot_artist, slot_index, artist_key);
+    flipchanger_breakdown_move(breakdown->genres, breakdown->slot_genre, slot_index, genre_key);
+    if(decade != breakdown->slot_decade[slot_index]) {
+        if(breakdown->slot_decade[slot_index] != STATS_NO_DECADE) breakdown->decades[breakdown->slot_decade[slot_index]]--;
+        if(decade != STATS_NO_DECADE) breakdown->decades[decade]++;
+        breakdown->slot_decade[slot_index] = decade;
+    }
+}
+
+static void flipchanger_breakdown_put_cached(FlipChangerApp* app, const CachedSlot* slot) {
+    if(!app->breakdown) return;
+    char artist[STATS_KEY_LEN];
+    char genre[STATS_KEY_LEN];
+    flipchanger_unpack_string(slot->artist, artist, sizeof(artist));
+    flipchanger_unpack_string(slot->genre, genre, sizeof(genre));
+    flipchanger_breakdown_put(app, slot->slot_number - 1, slot->occupied, artist, genre, slot->year);
+}
+
+// Drop the breakdown (Changer switched); the next Statistics visit counts again
+static void flipchanger_breakdown_reset(FlipChangerApp* app) {
+    free(app->breakdown);
+    app->breakdown = NULL;
+}
+
+/**
+ * Count the next STATS_PASS_CHUNK slots (storage worker). Cached slots count as cached,
+ * slots the summary shows empty are skipped, the rest are read one record at a time.
+ * Returns true once every slot has been counted.
+ */
+static bool flipchanger_breakdown_step(FlipChangerApp* app) {
+    if(!app->breakdown) {
+        app->breakdown = malloc(sizeof(CollectionBreakdown));
+        if(!app->breakdown) return true;
+        memset(app->breakdown, 0, sizeof(CollectionBreakdown));
+        memset(app->breakdown->slot_artist, STATS_NO_COUNTER, sizeof(app->breakdown->slot_artist));
+        memset(app->breakdown->slot_genre, STATS_NO_COUNTER, sizeof(app->breakdown->slot_genre));
+        memset(app->breakdown->slot_decade, STATS_NO_DECADE, sizeof(app->breakdown->slot_decade));
+    }
+    CollectionBreakdown* breakdown = app->breakdown;
+    int32_t end = breakdown->scanned + STATS_PASS_CHUNK;
+    if(end > app->total_slots) end = app->total_slots;
+
+    Slot* slot = malloc(sizeof(Slot));
+    while(breakdown->scanned < end) {
+        int32_t slot_index = breakdown->scanned++;
+        const CachedSlot* cached = flipchanger_get_cached_slot(app, slot_index);
+        if(cached) {
+            flipchanger_breakdown_put_cached(app, cached);
+        } else if(app->summary[slot_index].occupied && flipchanger_read_slot(app, slot_index, slot)) {
+            flipchanger_breakdown_put(app, slot_index, slot->occupied, slot->cd.artist, slot->cd.genre, slot->cd.year);
+        }
+    }
+    free(slot);
+    return breakdown->scanned >= app->total_slots;
+}
+
+// Every slot counted? (read-only, for draw)
+static bool flipchanger_breakdown_done(const FlipChangerApp* app) {
+    return app->breakdown && app->breakdown->scanned >= app->total_slots;
+}
+
+// Breakdown of every slot available? Otherwise make sure the pass is queued (input handling and the worker)
+static bool flipchanger_breakdown_ready(FlipChangerApp* app) {
+    if(flipchanger_breakdown_done(app)) return true;
+    if(!app->breakdown_queued && flipchanger_storage_post(app, StorageRequestBreakdown, -1)) {
+        app->breakdown_queued = true;
+    }
+    return false;
+}
+
+/* === Term index (flipchanger_<id>.trm) - sorted word -> slot postings, searched by binary search === */
+
+// Build path to term index for current Changer (e.g. flipchanger_changer_0.trm)
+void flipchanger_get_terms_path(const FlipChangerApp* app, char* path_out, size_t path_size) {
+    if(!app || !path_out || path_size < 32 || app->current_changer_id[0] == '\0') {
+        if(path_out && path_size > 0) path_out[0] = '\0';
+        return;
+    }
+    snprintf(path_out, path_size, "%s/flipchanger_%s.trm", FLIPCHANGER_APP_DIR, app->current_changer_id);
+}
+
+// Files of any Changer by id and extension (the app's own paths cover the current one only)
+void flipchanger_get_changer_path(const char* changer_id, const char* ext, char* path_out, size_t path_size) {
+    snprintf(path_out, path_size, "%s/flipchanger_%s.%s", FLIPCHANGER_APP_DIR, changer_id, ext);
+}
+
+// Scratch files of a rebuild: run levels "0".."7", "new" (run just sorted) and "tmp" (merge output)
+static void flipchanger_terms_temp_path(const char* name, char* path_out, size_t path_size) {
+    snprintf(path_out, path_size, "%s/flipchanger_terms.%s", FLIPCHANGER_APP_DIR, name);
+}
+
+static void flipchanger_terms_level_path(int32_t level, char* path_out, size_t path_size) {
+    char name[4];
+    snprintf(name, sizeof(name), "%ld", (long)level);
+    flipchanger_terms_temp_path(name, path_out, path_size);
+}
+
+// Letters, digits and non-ASCII bytes (UTF-8 text) make up words; anything else separates them
+static bool flipchanger_terms_word_char(char c) {
+    return (c >= '0' && c <= '9') || (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || (unsigned char)c >= 0x80;
+}
+
+// Next word of text, upper-cased and cut to fit a term. Single characters are skipped.
+// Returns the text after it, or NULL when no word is left.
+static const char* flipchanger_terms_next_word(const char* text, char* word) {
+    while(true) {
+        while(*text != '\0' && !flipchanger_terms_word_char(*text)) text++;
+        if(*text == '\0') return NULL;
+        size_t len = 0;
+        for(; *text != '\0' && flipchanger_terms_word_char(*text); text++) {
+            char c = *text;
+            if(len < SEARCH_TERM_LEN - 1) word[len++] = (c >= 'a' && c <= 'z') ? (char)(c - 'a' + 'A') : c;
+        }
+        word[len] = '\0';
+        if(len > 1) return text;
+    }
+}
+
+// Stamp the header with the slot store (same fields the slot summary is checked against)
+static void flipchanger_terms_stamp(FlipChangerApp* app, TermIndexHeader* header) {
+    SlotSummaryHeader stamp;
+    flipchanger_summary_stamp(app, &stamp);
+    header->magic = TERM_INDEX_MAGIC;
+    header->version = TERM_INDEX_VERSION;
+    header->entry_size = sizeof(TermEntry);
+    header->store_size = stamp.store_size;
+    header->store_mtime = stamp.store_mtime;
+    header->journal_size = stamp.journal_size;
+    memcpy(header->dirty, app->terms_dirty, sizeof(header->dirty));
+}
+
+// Read the header of the current Changer's index (NULL file when missing or another layout)
+static File* flipchanger_terms_open(FlipChangerApp* app, TermIndexHeader* header) {
+    char path[64];
+    flipchanger_get_terms_path(app, path, sizeof(path));
+    if(path[0] == '\0') return NULL;
+    File* file = storage_file_alloc(app->storage);
+    if(storage_file_open(file, path, FSAM_READ, FSOM_OPEN_EXISTING) &&
+       storage_file_read(file, header, sizeof(TermIndexHeader)) == sizeof(TermIndexHeader) &&
+       header->magic == TERM_INDEX_MAGIC && header->version == TERM_INDEX_VERSION &&
+       header->entry_size == sizeof(TermEntry)) {
+        return file;
+    }
+    storage_file_close(file);
+    storage_file_free(file);
+    return NULL;
+}
+
+// Store changed without the index knowing (dirty bit set, or rewritten with the same slots):
+// move the stamp and dirty bits in place. Nothing to do while the index is stale anyway.
+static void flipchanger_terms_restamp(FlipChangerApp* app) {
+    if(!app->terms_valid) return;
+    char path[64];
+    flipchanger_get_terms_path(app, path, sizeof(path));
+    TermIndexHeader header;
+    File* file = storage_file_alloc(app->storage);
+    bool ok = storage_file_open(file, path, FSAM_READ_WRITE, FSOM_OPEN_EXISTING) &&
+              storage_file_read(file, &header, sizeof(header)) == sizeof(header);
+    if(ok) {
+        flipchanger_terms_stamp(app, &header);
+        ok = storage_file_seek(file, 0, true) && storage_file_write(file, &header, sizeof(header)) == sizeof(header);
+    }
+    storage_file_close(file);
+    storage_file_free(file);
+    if(!ok) app->terms_valid = false;
+}
+
+// Slot written to the store: its postings no longer count (searched from its record instead)
+static void flipchanger_terms_mark(FlipChangerApp* app, int32_t slot_index) {
+    if(slot_index < 0 || slot_index >= MAX_SLOTS) return;
+    app->terms_dirty[slot_index / 8] |= (1 << (slot_index % 8));
+    flipchanger_search_forget(app);
+}
+
+static int32_t flipchanger_terms_dirty_count(const FlipChangerApp* app) {
+    int32_t count = 0;
+    for(int32_t i = 0; i < MAX_SLOTS; i++) {
+        if(app->terms_dirty[i / 8] & (1 << (i % 8))) count++;
+    }
+    return count;
+}
+
+// Drop a rebuild in progress and its scratch files
+static void flipchanger_terms_abort(FlipChangerApp* app) {
+    if(!app->term_build) return;
+    char path[72];
+    for(int32_t level = 0; level < 8; level++) {
+        if(app->term_build->levels & (1 << level)) {
+            flipchanger_terms_level_path(level, path, sizeof(path));
+            storage_common_remove(app->storage, path);
+        }
+    }
+    free(app->term_build);
+    app->term_build = NULL;
+}
+
+// Index of the Changer just loaded: usable when its stamp matches the store (called before
+// anything can write the store, so a journal fold-in can restamp it)
+static void flipchanger_terms_load(FlipChangerApp* app) {
+    flipchanger_terms_abort(app);
+    app->terms_valid = false;
+    memset(app->terms_dirty, 0, sizeof(app->terms_dirty));
+
+    TermIndexHeader header;
+    File* file = flipchanger_terms_open(app, &header);
+    if(!file) return;
+    storage_file_close(file);
+    storage_file_free(file);
+    memcpy(app->terms_dirty, header.dirty, sizeof(app->terms_dirty));
+    TermIndexHeader expected;
+    flipchanger_terms_stamp(app, &expected);
+    app->terms_valid = header.store_size == expected.store_size && header.store_mtime == expected.store_mtime &&
+                       header.journal_size == expected.journal_size;
+    if(!app->terms_valid) memset(app->terms_dirty, 0, sizeof(app->terms_dirty));
+}
+
+/* Buffered sequential access to a run file while merging */
+typedef struct {
+    File* file;
+    TermEntry buf[SEARCH_MERGE_BUFFER];
+    int32_t count;
+    int32_t pos;
+} TermStream;
+
+// Current entry of a stream being read (NULL at its end)
+static const TermEntry* term_stream_peek(TermStream* s) {
+    if(s->pos >= s->count) {
+        s->count = s->file ? (int32_t)(storage_file_read(s->file, s->buf, sizeof(s->buf)) / sizeof(TermEntry)) : 0;
+        s->pos = 0;
+        if(s->count == 0) return NULL;
+    }
+    return &s->buf[s->pos];
+}
+
+// Append to a stream being written; a duplicate of the last entry is dropped
+static bool term_stream_put(TermStream* s, const TermEntry* entry, TermEntry* last, bool* has_last) {
+    if(*has_last && memcmp(entry, last, sizeof(TermEntry)) == 0) return true;
+    *last = *entry;
+    *has_last = true;
+    s->buf[s->count++] = *entry;
+    if(s->count < SEARCH_MERGE_BUFFER) return true;
+    s->count = 0;
+    return storage_file_write(s->file, s->buf, sizeof(s->buf)) == sizeof(s->buf);
+}
+
+static bool term_stream_open(FlipChangerApp* app, TermStream* s, const char* path, bool write) {
+    s->file = storage_file_alloc(app->storage);
+    s->count = 0;
+    s->pos = 0;
+    bool ok = storage_file_open(s->file, path, write ? FSAM_WRITE : FSAM_READ, write ? FSOM_CREATE_ALWAYS : FSOM_OPEN_EXISTING);
+    if(ok && write) {
+        TermIndexHeader gap;  // Every run file keeps room for the header, so any can become the index
+        memset(&gap, 0, sizeof(gap));
+        ok = storage_file_write(s->file, &gap, sizeof(gap)) == sizeof(gap);
+    } else if(ok) {
+        ok = storage_file_seek(s->file, sizeof(TermIndexHeader), true);
+    }
+    return ok;
+}
+
+static bool term_stream_close(TermStream* s, bool write) {
+    bool ok = true;
+    if(write && s->count > 0) {
+        size_t size = s->count * sizeof(TermEntry);
+        ok = storage_file_write(s->file, s->buf, size) == size;
+    }
+    ok = storage_file_close(s->file) && ok;
+    storage_file_free(s->file);
+    s->file = NULL;
+    return ok;
+}
+
+// Merge two sorted run files into out_path (duplicates dropped); the inputs are removed
+static bool flipchanger_terms_merge(FlipChangerApp* app, const char* a_path, const char* b_path, const char* out_path) {
+    TermStream* s = malloc(sizeof(TermStream) * 3);
+    if(!s) return false;
+    bool ok = term_stream_open(app, &s[0], a_path, false);
+    ok = term_stream_open(app, &s[1], b_path, false) && ok;
+    ok = term_stream_open(app, &s[2], out_path, true) && ok;
+    TermEntry last;
+    bool has_last = false;
+    while(ok) {
+        const TermEntry* a = term_stream_peek(&s[0]);
+        const TermEntry* b = term_stream_peek(&s[1]);
+        if(!a && !b) break;
+        if(a && (!b || memcmp(a, b, sizeof(TermEntry)) <= 0)) {
+            ok = term_stream_put(&s[2], a, &last, &has_last);
+            s[0].pos++;
+        } else {
+            ok = term_stream_put(&s[2], b, &last, &has_last);
+            s[1].pos++;
+        }
+    }
+    term_stream_close(&s[0], false);
+    term_stream_close(&s[1], false);
+    ok = term_stream_close(&s[2], true) && ok;
+    free(s);
+    storage_common_remove(app->storage, a_path);
+    storage_common_remove(app->storage, b_path);
+    return ok;
+}
+
+static int flipchanger_terms_compare(const void* a, const void* b) {
+    return memcmp(a, b, sizeof(TermEntry));
+}
+
+/**
+ * Sort the postings collected in RAM into a run file and carry it up the levels: while a
+ * run of the same level exists the two are merged and the result moves up one level.
+ */
+static bool flipchanger_terms_flush_run(FlipChangerApp* app) {
+    TermBuild* build = app->term_build;
+    if(build->run_count == 0) return true;
+    qsort(build->run, build->run_count, sizeof(TermEntry), flipchanger_terms_compare);
+
+    char new_path[72];
+    char level_path[72];
+    char tmp_path[72];
+    flipchanger_terms_temp_path("new", new_path, sizeof(new_path));
+    flipchanger_terms_temp_path("tmp", tmp_path, sizeof(tmp_path));
+    TermStream* out = malloc(sizeof(TermStream));
+    if(!out) return false;
+    bool ok = term_stream_open(app, out, new_path, true);
+    TermEntry last;
+    bool has_last = false;
+    for(int32_t i = 0; ok && i < build->run_count; i++) {
+        ok = term_stream_put(out, &build->run[i], &last, &has_last);
+    }
+    ok = term_stream_close(out, true) && ok;
+    free(out);
+    build->run_count = 0;
+
+    for(int32_t level = 0; ok && level < 8; level++) {
+        flipchanger_terms_level_path(level, level_path, sizeof(level_path));
+        if(!(build->levels & (1 << level))) {
+            ok = storage_common_rename(app->storage, new_path, level_path) == FSE_OK;
+            if(ok) build->levels |= (1 << level);
+            return ok;
+        }
+        build->levels &= ~(1 << level);
+        ok = flipchanger_terms_merge(app, level_path, new_path, tmp_path) &&
+             storage_common_rename(app->storage, tmp_path, new_path) == FSE_OK;
+    }
+    return false;  // 2^8 runs: more postings than MAX_SLOTS can produce
+}
+
+// Add every word of text as a posting of slot/field
+static bool flipchanger_terms_add(FlipChangerApp* app, const char* text, int32_t slot_index, uint8_t field) {
+    TermBuild* build = app->term_build;
+    char word[SEARCH_TERM_LEN];
+    while((text = flipchanger_terms_next_word(text, word)) != NULL) {
+        if(build->run_count >= SEARCH_RUN_ENTRIES && !flipchanger_terms_flush_run(app)) return false;
+        TermEntry* entry = &build->run[build->run_count++];
+        memset(entry, 0, sizeof(TermEntry));
+        strncpy(entry->term, word, SEARCH_TERM_LEN - 1);
+        entry->slot = (uint8_t)slot_index;
+        entry->field = field;
+    }
+    return true;
+}
+
+// Merge the remaining run files into one and install it as the index, header written last
+static bool flipchanger_terms_finish(FlipChangerApp* app) {
+    TermBuild* build = app->term_build;
+    bool ok = flipchanger_terms_flush_run(app);
+    char path[64];
+    char new_path[72];
+    char level_path[72];
+    char tmp_path[72];
+    flipchanger_get_terms_path(app, path, sizeof(path));
+    flipchanger_terms_temp_path("new", new_path, sizeof(new_path));
+    flipchanger_terms_temp_path("tmp", tmp_path, sizeof(tmp_path));
+
+    // Fold the levels together, smallest first, into "new"
+    bool have_new = false;
+    for(int32_t level = 0; ok && level < 8; level++) {
+        if(!(build->levels & (1 << level))) continue;
+        build->levels &= ~(1 << level);
+        flipchanger_terms_level_path(level, level_path, sizeof(level_path));
+        if(!have_new) {
+            ok = storage_common_rename(app->storage, level_path, new_path) == FSE_OK;
+            have_new = ok;
+        } else {
+            ok = flipchanger_terms_merge(app, level_path, new_path, tmp_path) &&
+                 storage_common_rename(app->storage, tmp_path, new_path) == FSE_OK;
+        }
+    }
+    if(ok && !have_new) {
+        TermStream* out = malloc(sizeof(TermStream));  // Nothing indexed: header-only file
+        ok = out && term_stream_open(app, out, new_path, true);
+        if(out) {
+            ok = term_stream_close(out, true) && ok;
+            free(out);
+        }
+    }
+
+    File* file = storage_file_alloc(app->storage);
+    if(ok && storage_file_open(file, new_path, FSAM_READ_WRITE, FSOM_OPEN_EXISTING)) {
+        TermIndexHeader header;
+        memset(&header, 0, sizeof(header));
+        flipchanger_terms_stamp(app, &header);
+        header.entry_count = (uint32_t)((storage_file_size(file) - sizeof(TermIndexHeader)) / sizeof(TermEntry));
+        ok = storage_file_seek(file, 0, true) && storage_file_write(file, &header, sizeof(header)) == sizeof(header);
+        ok = storage_file_close(file) && ok;
+    } else {
+        ok = false;
+    }
+    storage_file_free(file);
+    if(ok) {
+        storage_common_remove(app->storage, path);
+        ok = storage_common_rename(app->storage, new_path, path) == FSE_OK;
+    }
+    if(!ok) storage_common_remove(app->storage, new_path);
+    app->terms_valid = ok;
+    flipchanger_terms_abort(app);
+    return ok;
+}
+
+/**
+ * Index the next SEARCH_BUILD_CHUNK slots of a rebuild (storage worker). Slots the summary
+ * shows empty are skipped, the rest are read from the store with their track lists.
+ * Returns true once the rebuild has finished (or failed).
+ */
+static bool flipchanger_terms_step(FlipChangerApp* app) {
+    TermBuild* build = app->term_build;
+    if(!build) return true;
+    if(build->scanned == 0) {
+        // Slots saved from here on are flagged dirty in the new index
+        memset(app->terms_dirty, 0, sizeof(app->terms_dirty));
+        app->terms_valid = false;
+        flipchanger_search_forget(app);  // Cached posting ranges point into the old index
+    }
+    int32_t end = build->scanned + SEARCH_BUILD_CHUNK;
+    if(end > app->total_slots) end = app->total_slots;
+
+    Slot* slot = malloc(sizeof(Slot));
+    TrackList* tracks = malloc(sizeof(TrackList));
+    bool ok = slot && tracks;
+    while(ok && build->scanned < end) {
+        int32_t slot_index = build->scanned++;
+        if(!app->summary[slot_index].occupied || !flipchanger_read_slot(app, slot_index, slot) || !slot->occupied) continue;
+        flipchanger_tracks_read(app, slot, tracks);
+        ok = flipchanger_terms_add(app, slot->cd.artist, slot_index, SEARCH_FIELD_ARTIST) &&
+             flipchanger_terms_add(app, slot->cd.album_artist, slot_index, SEARCH_FIELD_ARTIST) &&
+             flipchanger_terms_add(app, slot->cd.album, slot_index, SEARCH_FIELD_ALBUM);
+        for(int32_t t = 0; ok && t < slot->cd.track_count && t < MAX_TRACKS; t++) {
+            ok = flipchanger_terms_add(app, tracks->tracks[t].title, slot_index, SEARCH_FIELD_TRACK + t);
+        }
+    }
+    free(tracks);
+    free(slot);
+
+    if(!ok) {
+        flipchanger_terms_abort(app);
+        return true;
+    }
+    if(build->scanned < app->total_slots) return false;
+    flipchanger_terms_finish(app);
+    return true;
+}
+
+// Index usable for a search? Otherwise make sure its rebuild is queued (input handling and the worker)
+static bool flipchanger_terms_ready(FlipChangerApp* app) {
+    if(!app->term_build && app->terms_valid && flipchanger_terms_dirty_count(app) <= SEARCH_DIRTY_LIMIT) return true;
+    if(!app->term_build) {
+        app->term_build = malloc(sizeof(TermBuild));
+        if(!app->term_build) return false;
+        memset(app->term_build, 0, sizeof(TermBuild));
+    }
+    if(!app->term_build->queued && flipchanger_storage_post(app, StorageRequestTermBuild, -1)) {
+        app->term_build->queued = true;
+    }
+    return false;
+}
+
+// Does any word of text start with word? (a dirty slot's fields, matched like index terms)
+static bool flipchanger_terms_text_matches(const char* text, const char* word) {
+    char term[SEARCH_TERM_LEN];
+    size_t len = strlen(word);
+    while((text = flipchanger_terms_next_word(text, term)) != NULL) {
+        if(strncmp(term, word, len) == 0) return true;
+    }
+    return false;
+}
+
+/**
+ * Mark in match every slot with a word starting with word, and record where it matched in
+ * fields (lowest SEARCH_FIELD_* wins; NULL = not wanted). Only postings in [*low, *high) are
+ * looked at: binary search for the first term >= word, then one sequential read over the
+ * postings that share the prefix, whose range is returned in *low and *high. The postings of a
+ * word typed one character further lie inside that range. Dirty slots are skipped here.
+ */
+static void flipchanger_terms_lookup(
+    FlipChangerApp* app, const char* word, uint8_t* match, uint8_t* fields, uint32_t* low, uint32_t* high) {
+    TermIndexHeader header;
+    File* file = flipchanger_terms_open(app, &header);
+    if(!file) {
+        *low = 0;
+        *high = 0;
+        return;
+    }
+    if(*high > header.entry_count) *high = header.entry_count;
+    if(*low > *high) *low = *high;
+    size_t len = strlen(word);
+    TermEntry entry;
+    uint32_t first = *low;
+    uint32_t last = *high;
+    while(first < last) {
+        uint32_t mid = first + (last - first) / 2;
+        if(!storage_file_seek(file, sizeof(TermIndexHeader) + mid * sizeof(TermEntry), true) ||
+           storage_file_read(file, &entry, sizeof(entry)) != sizeof(entry)) {
+            break;
+        }
+        if(strncmp(entry.term, word, SEARCH_TERM_LEN) < 0) {
+            first = mid + 1;
+        } else {
+            last = mid;
+        }
+    }
+
+    uint32_t end = first;
+    TermStream* s = malloc(sizeof(TermStream));
+    if(s && storage_file_seek(file, sizeof(TermIndexHeader) + first * sizeof(TermEntry), true)) {
+        s->file = file;
+        s->count = 0;
+        s->pos = 0;
+        for(; end < *high; end++, s->pos++) {
+            const TermEntry* e = term_stream_peek(s);
+            if(!e || strncmp(e->term, word, len) != 0) break;
+            if(e->slot >= app->total_slots || (app->terms_dirty[e->slot / 8] & (1 << (e->slot % 8)))) continue;
+            match[e->slot / 8] |= (1 << (e->slot % 8));
+            if(fields && e->field < fields[e->slot]) fields[e->slot] = e->field;
+        }
+    }
+    free(s);
+    storage_file_close(file);
+    storage_file_free(file);
+    *low = first;
+    *high = end;
+}
+
+// Split a query into up to SEARCH_QUERY_WORDS words, normalized like index terms
+static int32_t flipchanger_search_words(const char* query, char words[][SEARCH_TERM_LEN]) {
+    int32_t word_count = 0;
+    while(word_count < SEARCH_QUERY_WORDS && (query = flipchanger_terms_next_word(query, words[word_count])) != NULL) {
+        word_count++;
+    }
+    return word_count;
+}
+
+// Words of the first len characters of the query
+static int32_t flipchanger_search_prefix_words(const SearchState* search, int32_t len, char words[][SEARCH_TERM_LEN]) {
+    char prefix[SEARCH_QUERY_LEN];
+    memcpy(prefix, search->query, len);
+    prefix[len] = '\0';
+    return flipchanger_search_words(prefix, words);
+}
+
+// Does the query's character len leave its words as they were (separator, a 1-character word,
+// past the word limit or the term length)? Then its candidate set is the one before it.
+static bool flipchanger_search_same_words(const SearchState* search, int32_t len) {
+    char words[SEARCH_QUERY_WORDS][SEARCH_TERM_LEN];
+    char prev_words[SEARCH_QUERY_WORDS][SEARCH_TERM_LEN];
+    int32_t count = flipchanger_search_prefix_words(search, len, words);
+    if(flipchanger_search_prefix_words(search, len - 1, prev_words) != count) return false;
+    for(int32_t w = 0; w < count; w++) {
+        if(strcmp(words[w], prev_words[w]) != 0) return false;
+    }
+    return true;
+}
+
+// Where word starts a word of a slot's own fields (SEARCH_FIELD_*), 0xFF = nowhere
+static uint8_t flipchanger_search_match_slot(const Slot* slot, const TrackList* tracks, const char* word) {
+    if(flipchanger_terms_text_matches(slot->cd.artist, word) || flipchanger_terms_text_matches(slot->cd.album_artist, word)) {
+        return SEARCH_FIELD_ARTIST;
+    }
+    if(flipchanger_terms_text_matches(slot->cd.album, word)) return SEARCH_FIELD_ALBUM;
+    for(int32_t t = 0; t < slot->cd.track_count && t < MAX_TRACKS; t++) {
+        if(flipchanger_terms_text_matches(tracks->tracks[t].title, word)) return SEARCH_FIELD_TRACK + t;
+    }
+    return 0xFF;
+}
+
+/**
+ * Mark in match the slots of candidates with a word starting with word: indexed ones through
+ * the postings in [*low, *high), slots saved since the build from their records.
+ */
+static void flipchanger_search_word(
+    FlipChangerApp* app,
+    const char* word,
+    const uint8_t* candidates,
+    uint8_t* match,
+    uint8_t* fields,
+    uint32_t* low,
+    uint32_t* high,
+    Slot* slot,
+    TrackList* tracks) {
+    flipchanger_terms_lookup(app, word, match, fields, low, high);
+    for(int32_t i = 0; i < app->total_slots; i++) {
+        if(!(candidates[i / 8] & (1 << (i % 8))) || !(app->terms_dirty[i / 8] & (1 << (i % 8)))) continue;
+        if(!app->summary[i].occupied || !flipchanger_read_slot(app, i, slot) || !slot->occupied) continue;
+        flipchanger_tracks_read(app, slot, tracks);
+        uint8_t field = flipchanger_search_match_slot(slot, tracks, word);
+        if(field == 0xFF) continue;
+        match[i / 8] |= (1 << (i % 8));
+        if(fields) fields[i] = field;
+    }
+}
+
+// Cached candidate sets no longer hold (slot saved, index rebuilt, catalog changed): the next
+// search starts over from the whole query
+static void flipchanger_search_forget(FlipChangerApp* app) {
+    if(!app->search) return;
+    app->search->level_first = 0;
+    app->search->level_count = 0;
+    app->search->base_len = -1;
+}
+
+// Level len straight from the index (storage worker): every word looked up in the whole index.
+// Used when nothing shorter is cached, so a long query does not walk every prefix.
+static void flipchanger_search_level(FlipChangerApp* app, int32_t len, Slot* slot, TrackList* tracks) {
+    SearchState* search = app->search;
+    SearchLevel* level = &search->levels[len];
+    memset(level->match, 0xFF, sizeof(level->match));
+    level->low = 0;
+    level->high = UINT32_MAX;
+    char words[SEARCH_QUERY_WORDS][SEARCH_TERM_LEN];
+    int32_t count = flipchanger_search_prefix_words(search, len, words);
+    for(int32_t w = 0; w < count; w++) {
+        uint8_t* fields = NULL;
+        if(w == 0) {
+            fields = search->fields;
+            memset(fields, 0xFF, MAX_SLOTS);
+            strncpy(search->fields_word, words[0], SEARCH_TERM_LEN);
+        }
+        uint8_t match[(MAX_SLOTS + 7) / 8];
+        memset(match, 0, sizeof(match));
+        level->low = 0;
+        level->high = UINT32_MAX;
+        flipchanger_search_word(app, words[w], level->match, match, fields, &level->low, &level->high, slot, tracks);
+        for(int32_t i = 0; i < (int32_t)sizeof(match); i++) level->match[i] &= match[i];
+    }
+}
+
+/**
+ * Level len from level len - 1 (storage worker). Only a changed last word costs a lookup: a
+ * word grown by one character is looked up inside its previous posting range, a new word in
+ * the whole index. Either way only slots still in the set can stay in it.
+ */
+static void flipchanger_search_narrow(FlipChangerApp* app, int32_t len, Slot* slot, TrackList* tracks) {
+    SearchState* search = app->search;
+    const SearchLevel* prev = &search->levels[len - 1];
+    SearchLevel* level = &search->levels[len];
+    *level = *prev;
+    if(flipchanger_search_same_words(search, len)) return;
+
+    char words[SEARCH_QUERY_WORDS][SEARCH_TERM_LEN];
+    char prev_words[SEARCH_QUERY_WORDS][SEARCH_TERM_LEN];
+    int32_t count = flipchanger_search_prefix_words(search, len, words);
+    if(flipchanger_search_prefix_words(search, len - 1, prev_words) != count) {
+        level->low = 0;  // New word
+        level->high = UINT32_MAX;
+    }
+    uint8_t* fields = NULL;
+    if(count == 1) {
+        fields = search->fields;
+        memset(fields, 0xFF, MAX_SLOTS);
+        strncpy(search->fields_word, words[0], SEARCH_TERM_LEN);
+    }
+    uint8_t match[(MAX_SLOTS + 7) / 8];
+    memset(match, 0, sizeof(match));
+    flipchanger_search_word(app, words[count - 1], prev->match, match, fields, &level->low, &level->high, slot, tracks);
+    for(int32_t i = 0; i < (int32_t)sizeof(match); i++) level->match[i] &= match[i];
+}
+
+// List the set of the whole query: the first SEARCH_MAX_HITS matches, and how many there are
+static void flipchanger_search_list(FlipChangerApp* app) {
+    SearchState* search = app->search;
+    int32_t len = strlen(search->query);
+    char words[SEARCH_QUERY_WORDS][SEARCH_TERM_LEN];
+    bool listed = len < search->level_count && len >= search->level_first && flipchanger_search_words(search->query, words) > 0;
+    search->hit_count = 0;
+    search->match_count = 0;
+    search->more = false;
+    if(search->global) {
+        listed = listed && search->base_len >= 0 && len >= search->base_len;
+        for(int32_t i = 0; listed && i < search->base_count; i++) {
+            if(!(search->masks[len] & (1u << i))) continue;
+            int32_t hit = search->hit_count++;
+            search->hits[hit] = search->base_slots[i];
+            search->hit_changers[hit] = search->base_changers[i];
+            search->hit_fields[hit] = 0xFF;
+            snprintf(search->hit_labels[hit], SEARCH_LABEL_LEN, "%s - %s", search->base_keys[i].artist, search->base_keys[i].album);
+        }
+        search->match_count = search->hit_count;
+        search->more = listed && search->base_more;
+    } else {
+        const uint8_t* match = search->levels[len].match;
+        for(int32_t i = 0; listed && i < app->total_slots; i++) {
+            if(!(match[i / 8] & (1 << (i % 8)))) continue;
+            search->match_count++;
+            if(search->hit_count >= SEARCH_MAX_HITS) continue;
+            search->hits[search->hit_count] = (uint8_t)i;
+            search->hit_fields[search->hit_count] = search->fields[i];
+            search->hit_count++;
+        }
+        search->more = search->match_count > search->hit_count;
+    }
+    search->selected = 0;
+    search->searched = true;
+}
+
+/**
+ * Bring the Search view's results up to its query (storage worker): every query word must
+ * prefix-match a word of the slot's artist, album artist, album or a track title. Levels for
+ * characters typed since the last run are narrowed one by one from the last cached one.
+ */
+static void flipchanger_search_run(FlipChangerApp* app) {
+    SearchState* search = app->search;
+    if(!search) return;
+    if(search->global) {
+        if(flipchanger_catalog_ready(app)) {
+            flipchanger_catalog_narrow(app);
+        } else {
+            search->pending = true;  // Run once every Changer is in the catalog
+        }
+        return;
+    }
+    if(!flipchanger_terms_ready(app)) {
+        search->pending = true;  // Run again once the rebuild finishes
+        return;
+    }
+
+    int32_t len = strlen(search->query);
+    Slot* slot = malloc(sizeof(Slot));
+    TrackList* tracks = malloc(sizeof(TrackList));
+    if(slot && tracks) {
+        if(len < search->level_first || search->level_count <= search->level_first) {
+            // Nothing cached to narrow from: look the whole query up, narrow from there on
+            flipchanger_search_level(app, len, slot, tracks);
+            search->level_first = len;
+            search->level_count = len + 1;
+        }
+        while(search->level_count <= len) {
+            flipchanger_search_narrow(app, search->level_count, slot, tracks);
+            search->level_count++;
+        }
+        // Deleted back into the first word: its set was cached, where it matched is looked up again
+        char words[SEARCH_QUERY_WORDS][SEARCH_TERM_LEN];
+        if(flipchanger_search_words(search->query, words) > 0 && strcmp(words[0], search->fields_word) != 0) {
+            uint8_t match[(MAX_SLOTS + 7) / 8];
+            memset(match, 0, sizeof(match));
+            memset(search->fields, 0xFF, MAX_SLOTS);
+            strncpy(search->fields_word, words[0], SEARCH_TERM_LEN);
+            uint32_t low = 0;
+            uint32_t high = UINT32_MAX;
+            flipchanger_search_word(app, words[0], search->levels[len].match, match, search->fields, &low, &high, slot, tracks);
+        }
+    }
+    free(tracks);
+    free(slot);
+    flipchanger_search_list(app);
+    search->pending = false;
+}
+
+/**
+ * Query edited (input handling): a shorter query lists its cached set straight away; a longer
+ * one is narrowed by the worker. No I/O here.
+ */
+static void flipchanger_search_typed(FlipChangerApp* app) {
+    SearchState* search = app->search;
+    // Re-queues an index rebuild or catalog import whose post was dropped
+    if(search->global) {
+        flipchanger_catalog_ready(app);
+    } else {
+        flipchanger_terms_ready(app);
+    }
+    int32_t len = strlen(search->query);
+    bool cached = len < search->level_count &&
+                  (search->global ? (search->base_len >= 0 && len >= search->base_len) : len >= search->level_first);
+    if(cached) {
+        search->level_count = len + 1;  // Deeper levels were for the deleted characters
+        flipchanger_search_list(app);
+        char words[SEARCH_QUERY_WORDS][SEARCH_TERM_LEN];
+        if(search->global || flipchanger_search_words(search->query, words) == 0 ||
+           strcmp(words[0], search->fields_word) == 0) {
+            return;
+        }
+    }
+    if(flipchanger_storage_post(app, StorageRequestSearch, -1)) search->pending = true;
+}
+
+/* === Global catalog - artist/album keys of every Changer's slots, for Find Disc === */
+
+static uint32_t flipchanger_catalog_offset(int32_t column, int32_t slot_index) {
+    return sizeof(CatalogHeader) + ((uint32_t)column * MAX_SLOTS + (uint32_t)slot_index) * sizeof(CatalogEntry);
+}
+
+static void flipchanger_catalog_entry(bool occupied, const char* artist, const char* album, CatalogEntry* entry) {
+    memset(entry, 0, sizeof(CatalogEntry));
+    if(!occupied) return;
+    flipchanger_normalize_key(artist, entry->artist, sizeof(entry->artist));
+    flipchanger_normalize_key(album, entry->album, sizeof(entry->album));
+}
+
+// Stamp a Changer's slot store by path, so Changers that are not loaded can be stamped too.
+// A .bin file means the binary store (an invalid one is rebuilt when its Changer loads).
+static void flipchanger_catalog_stamp(FlipChangerApp* app, const char* changer_id, CatalogColumn* column) {
+    column->store_size = 0;
+    column->store_mtime = 0;
+    column->journal_size = 0;
+    char path[64];
+    FileInfo info;
+    flipchanger_get_changer_path(changer_id, "bin", path, sizeof(path));
+    if(storage_common_stat(app->storage, path, &info) != FSE_OK) {
+        flipchanger_get_changer_path(changer_id, "jnl", path, sizeof(path));
+        if(storage_common_stat(app->storage, path, &info) == FSE_OK) column->journal_size = (uint32_t)info.size;
+        flipchanger_get_changer_path(changer_id, "json", path, sizeof(path));
+        if(storage_common_stat(app->storage, path, &info) != FSE_OK) return;
+    }
+    column->store_size = (uint32_t)info.size;
+    storage_common_timestamp(app->storage, path, &column->store_mtime);
+}
+
+// Open the catalog and read its header. A missing file, or one of another layout, is started
+// over empty when create is set; otherwise NULL.
+static File* flipchanger_catalog_open(FlipChangerApp* app, CatalogHeader* header, bool create) {
+    File* file = storage_file_alloc(app->storage);
+    if(storage_file_open(file, CATALOG_PATH, FSAM_READ_WRITE, FSOM_OPEN_EXISTING)) {
+        if(storage_file_read(file, header, sizeof(CatalogHeader)) == sizeof(CatalogHeader) &&
+           header->magic == CATALOG_MAGIC && header->version == CATALOG_VERSION &&
+           header->entry_size == sizeof(CatalogEntry)) {
+            return file;
+        }
+        storage_file_close(file);
+    }
+    memset(header, 0, sizeof(CatalogHeader));
+    header->magic = CATALOG_MAGIC;
+    header->version = CATALOG_VERSION;
+    header->entry_size = sizeof(CatalogEntry);
+    if(create && storage_file_open(file, CATALOG_PATH, FSAM_READ_WRITE, FSOM_CREATE_ALWAYS)) {
+        if(storage_file_write(file, header, sizeof(CatalogHeader)) == sizeof(CatalogHeader)) return file;
+        storage_file_close(file);
+    }
+    storage_file_free(file);
+    return NULL;
+}
+
+static void flipchanger_catalog_close(File* file) {
+    storage_file_close(file);
+    storage_file_free(file);
+}
+
+static bool flipchanger_catalog_write_column(File* file, int32_t column, const CatalogColumn* data) {
+    uint32_t offset = offsetof(CatalogHeader, columns) + (uint32_t)column * sizeof(CatalogColumn);
+    return storage_file_seek(file, offset, true) &&
+           storage_file_write(file, data, sizeof(CatalogColumn)) == sizeof(CatalogColumn);
+}
+
+static int32_t flipchanger_catalog_find(const CatalogHeader* header, const char* changer_id) {
+    for(int32_t column = 0; column < MAX_CHANGERS; column++) {
+        if(strncmp(header->columns[column].changer_id, changer_id, CHANGER_ID_LEN) == 0) return column;
+    }
+    return -1;
+}
+
+// Column for a Changer new to the catalog: a free one, or one left behind by a deleted Changer
+static int32_t flipchanger_catalog_claim(FlipChangerApp* app, const CatalogHeader* header) {
+    for(int32_t column = 0; column < MAX_CHANGERS; column++) {
+        const char* id = header->columns[column].changer_id;
+        if(id[0] == '\0') return column;
+        int32_t i = 0;
+        while(i < app->changer_count && strncmp(app->changers[i].id, id, CHANGER_ID_LEN) != 0) i++;
+        if(i == app->changer_count) return column;
+    }
+    return -1;
+}
+
+// Append empty entries up to offset (columns are written in place, never past the end of the file)
+static bool flipchanger_catalog_extend(File* file, uint32_t offset) {
+    uint64_t size = storage_file_size(file);
+    if(size >= offset) return true;
+    CatalogEntry* empty = malloc(sizeof(CatalogEntry) * CATALOG_READ_ENTRIES);
+    if(!empty) return false;
+    memset(empty, 0, sizeof(CatalogEntry) * CATALOG_READ_ENTRIES);
+    bool ok = storage_file_seek(file, size, true);
+    while(ok && size < offset) {
+        size_t chunk = sizeof(CatalogEntry) * CATALOG_READ_ENTRIES;
+        if(chunk > offset - size) chunk = offset - size;
+        ok = storage_file_write(file, empty, chunk) == chunk;
+        size += chunk;
+    }
+    free(empty);
+    return ok;
+}
+
+// Write one slot of the current Changer (store just written); nothing until the Changer is imported
+static void flipchanger_catalog_put(FlipChangerApp* app, int32_t slot_index, bool occupied, const char* artist, const char* album) {
+    if(app->catalog_column < 0 || slot_index < 0 || slot_index >= MAX_SLOTS) return;
+    flipchanger_search_forget(app);
+    CatalogEntry entry;
+    flipchanger_catalog_entry(occupied, artist, album, &entry);
+    File* file = storage_file_alloc(app->storage);
+    bool ok = storage_file_open(file, CATALOG_PATH, FSAM_READ_WRITE, FSOM_OPEN_EXISTING) &&
+              storage_file_seek(file, flipchanger_catalog_offset(app->catalog_column, slot_index), true) &&
+              storage_file_write(file, &entry, sizeof(entry)) == sizeof(entry);
+    flipchanger_catalog_close(file);
+    if(!ok) app->catalog_column = -1;
+}
+
+static void flipchanger_catalog_put_cached(FlipChangerApp* app, const CachedSlot* slot) {
+    if(app->catalog_column < 0) return;
+    char artist[CATALOG_KEY_LEN];
+    char album[CATALOG_KEY_LEN];
+    flipchanger_unpack_string(slot->artist, artist, sizeof(artist));
+    flipchanger_unpack_string(slot->album, album, sizeof(album));
+    flipchanger_catalog_put(app, slot->slot_number - 1, slot->occupied, artist, album);
+}
+
+// Store changed (slot written, or rewritten with the same slots): move the current column's stamp
+static void flipchanger_catalog_restamp(FlipChangerApp* app) {
+    if(app->catalog_column < 0) return;
+    CatalogColumn column;
+    memset(&column, 0, sizeof(column));
+    strncpy(column.changer_id, app->current_changer_id, CHANGER_ID_LEN - 1);
+    flipchanger_catalog_stamp(app, app->current_changer_id, &column);
+    column.complete = 1;
+    File* file = storage_file_alloc(app->storage);
+    bool ok = storage_file_open(file, CATALOG_PATH, FSAM_READ_WRITE, FSOM_OPEN_EXISTING) &&
+              flipchanger_catalog_write_column(file, app->catalog_column, &column);
+    flipchanger_catalog_close(file);
+    if(!ok) app->catalog_column = -1;
+}
+
+// Column of the Changer just loaded: kept up to date from here on when its stamp matches the
+// store, otherwise flagged for import (called before anything can write the store)
+static void flipchanger_catalog_load(FlipChangerApp* app) {
+    app->catalog_column = -1;
+    CatalogHeader* header = malloc(sizeof(CatalogHeader));
+    File* file = header ? flipchanger_catalog_open(app, header, false) : NULL;
+    if(file) {
+        int32_t column = flipchanger_catalog_find(header, app->current_changer_id);
+        if(column >= 0 && header->columns[column].complete) {
+            CatalogColumn* stored = &header->columns[column];
+            CatalogColumn expected;
+            flipchanger_catalog_stamp(app, app->current_changer_id, &expected);
+            if(stored->store_size == expected.store_size && stored->store_mtime == expected.store_mtime &&
+               stored->journal_size == expected.journal_size) {
+                app->catalog_column = column;
+            } else {
+                stored->complete = 0;  // Changed behind the catalog's back (or a save was lost)
+                flipchanger_catalog_write_column(file, column, stored);
+            }
+        }
+        flipchanger_catalog_close(file);
+    }
+    free(header);
+    if(app->catalog_column < 0) app->catalog_todo = -1;
+}
+
+/**
+ * Read every slot of a Changer from its own files into entries (MAX_SLOTS): the records of
+ * a binary store, or the JSON slots file with its journal replayed over it.
+ */
+static bool flipchanger_catalog_read_changer(FlipChangerApp* app, const char* changer_id, CatalogEntry* entries) {
+    memset(entries, 0, sizeof(CatalogEntry) * MAX_SLOTS);
+    Slot* slot = malloc(sizeof(Slot));
+    if(!slot) return false;
+    char path[64];
+    File* file = storage_file_alloc(app->storage);
+
+    bool binary = false;
+    flipchanger_get_changer_path(changer_id, "bin", path, sizeof(path));
+    if(storage_file_open(file, path, FSAM_READ, FSOM_OPEN_EXISTING)) {
+        SlotStoreHeader header;
+        binary = storage_file_read(file, &header, sizeof(header)) == sizeof(header) &&
+                 header.magic == SLOT_STORE_MAGIC && header.version == SLOT_STORE_VERSION &&
+                 header.header_size == sizeof(SlotStoreHeader) && header.record_size == sizeof(Slot);
+        for(int32_t i = 0; binary && i < MAX_SLOTS; i++) {
+            if(storage_file_read(file, slot, sizeof(Slot)) != sizeof(Slot)) break;
+            flipchanger_sanitize_slot(slot, i);
+            flipchanger_catalog_entry(slot->occupied, slot->cd.artist, slot->cd.album, &entries[i]);
+        }
+        storage_file_close(file);
+    }
+
+    // Otherwise the JSON file is the source of truth, as when the Changer loads
+    bool ok = binary;
+    flipchanger_get_changer_path(changer_id, "json", path, sizeof(path));
+    if(!binary && storage_file_open(file, path, FSAM_READ, FSOM_OPEN_EXISTING)) {
+        ok = true;
+        JsonReader* r = json_reader_alloc(file);
+        char key[24];
+        if(json_reader_expect(r, '{')) {
+            while(json_reader_next_key(r, key, sizeof(key))) {
+                if(strcmp(key, "slots") != 0 || !json_reader_expect(r, '[')) {
+                    json_reader_copy_value(r, NULL, 0);
+                    continue;
+                }
+                int32_t position = 0;
+                while(json_reader_next_element(r)) {
+                    position++;
+                    if(json_reader_skip_ws(r) != '{') {
+                        json_reader_copy_value(r, NULL, 0);
+                        continue;
+                    }
+                    int32_t slot_num = flipchanger_parse_slot(r, slot, NULL, 0, MAX_SLOTS);
+                    if(slot_num < 0) continue;  // Tombstone
+                    if(slot_num == 0) slot_num = position;
+                    if(slot_num > MAX_SLOTS) continue;
+                    flipchanger_catalog_entry(slot->occupied, slot->cd.artist, slot->cd.album, &entries[slot_num - 1]);
+                }
+            }
+        }
+        free(r);
+        storage_file_close(file);
+
+        flipchanger_get_changer_path(changer_id, "jnl", path, sizeof(path));
+        if(storage_file_open(file, path, FSAM_READ, FSOM_OPEN_EXISTING)) {
+            r = json_reader_alloc(file);
+            while(flipchanger_journal_next(r, slot, NULL, 0, MAX_SLOTS)) {
+                flipchanger_catalog_entry(slot->occupied, slot->cd.artist, slot->cd.album, &entries[slot->slot_number - 1]);
+            }
+            free(r);
+            storage_file_close(file);
+        }
+    }
+    storage_file_free(file);
+    free(slot);
+    return ok;
+}
+
+/**
+ * Import the first Changer in the registry whose column is missing or stale (storage worker,
+ * one Changer per request): its entries are written while the column is flagged incomplete,
+ * then the column is stamped. Returns true once no Changer is left to import.
+ */
+static bool flipchanger_catalog_step(FlipChangerApp* app) {
+    CatalogHeader* header = malloc(sizeof(CatalogHeader));
+    CatalogEntry* entries = malloc(sizeof(CatalogEntry) * MAX_SLOTS);
+    File* file = (header && entries) ? flipchanger_catalog_open(app, header, true) : NULL;
+    int32_t todo = 0;
+    int32_t target = -1;
+    for(int32_t i = 0; file && i < app->changer_count; i++) {
+        int32_t column = flipchanger_catalog_find(header, app->changers[i].id);
+        if(column >= 0 && header->columns[column].complete) continue;
+        if(target < 0) target = i;
+        todo++;
+    }
+
+    bool ok = file != NULL;
+    if(target >= 0) {
+        const char* id = app->changers[target].id;
+        int32_t column = flipchanger_catalog_find(header, id);
+        if(column < 0) column = flipchanger_catalog_claim(app, header);
+        ok = column >= 0;
+        if(ok) {
+            CatalogColumn* data = &header->columns[column];
+            memset(data, 0, sizeof(CatalogColumn));
+            strncpy(data->changer_id, id, CHANGER_ID_LEN - 1);
+            ok = flipchanger_catalog_write_column(file, column, data) &&
+                 flipchanger_catalog_read_changer(app, id, entries) &&
+                 flipchanger_catalog_extend(file, flipchanger_catalog_offset(column, 0)) &&
+                 storage_file_seek(file, flipchanger_catalog_offset(column, 0), true) &&
+                 storage_file_write(file, entries, sizeof(CatalogEntry) * MAX_SLOTS) == sizeof(CatalogEntry) * MAX_SLOTS;
+            if(ok) {
+                flipchanger_catalog_stamp(app, id, data);
+                data->complete = 1;
+                ok = flipchanger_catalog_write_column(file, column, data);
+            }
+        }
+        if(ok) {
+            todo--;
+            if(target == app->current_changer_index) app->catalog_column = column;
+            flipchanger_search_forget(app);
+        }
+    }
+    if(file) flipchanger_catalog_close(file);
+    free(entries);
+    free(header);
+
+    // A failed import is not retried in a loop: Find Disc answers from the columns there are,
+    // and the next Changer load tries again
+    app->catalog_todo = ok ? todo : 0;
+    return app->catalog_todo == 0;
+}
+
+// Every Changer in the catalog? Otherwise make sure an import is queued (input handling and the worker)
+static bool flipchanger_catalog_ready(FlipChangerApp* app) {
+    if(app->catalog_todo == 0) return true;
+    if(!app->catalog_queued && flipchanger_storage_post(app, StorageRequestCatalogSync, -1)) {
+        app->catalog_queued = true;
+    }
+    return false;
+}
+
+/**
+ * Scan the catalog for Find Disc's query (storage worker): every query word must prefix-match
+ * a word of the artist or album key. Each Changer's column is read CATALOG_READ_ENTRIES slots
+ * at a time; no slot store is opened. The hits become the base later characters narrow.
+ */
+static void flipchanger_catalog_lookup(FlipChangerApp* app) {
+    SearchState* search = app->search;
+    char words[SEARCH_QUERY_WORDS][SEARCH_TERM_LEN];
+    int32_t word_count = flipchanger_search_words(search->query, words);
+    search->base_count = 0;
+    search->base_more = false;
+
+    CatalogHeader* header = malloc(sizeof(CatalogHeader));
+    CatalogEntry* block = malloc(sizeof(CatalogEntry) * CATALOG_READ_ENTRIES);
+    File* file = (header && block && word_count > 0) ? flipchanger_catalog_open(app, header, false) : NULL;
+    for(int32_t c = 0; file && c < app->changer_count && !search->base_more; c++) {
+        int32_t column = flipchanger_catalog_find(header, app->changers[c].id);
+        if(column < 0 || !header->columns[column].complete) continue;
+        int32_t slots = app->changers[c].total_slots;
+        if(slots > MAX_SLOTS) slots = MAX_SLOTS;
+        if(!storage_file_seek(file, flipchanger_catalog_offset(column, 0), true)) continue;
+
+        for(int32_t first = 0; first < slots && !search->base_more; first += CATALOG_READ_ENTRIES) {
+            int32_t count = (slots - first < CATALOG_READ_ENTRIES) ? slots - first : CATALOG_READ_ENTRIES;
+            if(storage_file_read(file, block, sizeof(CatalogEntry) * count) != sizeof(CatalogEntry) * count) break;
+            for(int32_t i = 0; i < count; i++) {
+                CatalogEntry* entry = &block[i];
+                entry->artist[CATALOG_KEY_LEN - 1] = '\0';
+                entry->album[CATALOG_KEY_LEN - 1] = '\0';
+                bool all = entry->artist[0] != '\0' || entry->album[0] != '\0';
+                for(int32_t w = 0; all && w < word_count; w++) {
+                    all = flipchanger_terms_text_matches(entry->artist, words[w]) ||
+                          flipchanger_terms_text_matches(entry->album, words[w]);
+                }
+                if(!all) continue;
+                if(search->base_count >= SEARCH_MAX_HITS) {
+                    search->base_more = true;
+                    break;
+                }
+                int32_t hit = search->base_count++;
+                search->base_slots[hit] = (uint8_t)(first + i);
+                search->base_changers[hit] = (uint8_t)c;
+                search->base_keys[hit] = *entry;
+            }
+        }
+    }
+    if(file) flipchanger_catalog_close(file);
+    free(block);
+    free(header);
+}
+
+/**
+ * Bring Find Disc's results up to its query (storage worker). While the last scan listed every
+ * match, each typed character filters those hits in RAM (masks, one bit per base hit); a scan
+ * that stopped at SEARCH_MAX_HITS only carries over characters that leave the words alone.
+ */
+static void flipchanger_catalog_narrow(FlipChangerApp* app) {
+    SearchState* search = app->search;
+    int32_t len = strlen(search->query);
+    bool scan = search->base_len < 0 || len < search->base_len || search->level_count <= search->base_len;
+    for(int32_t k = search->level_count; !scan && k <= len; k++) {
+        if(flipchanger_search_same_words(search, k)) {
+            search->masks[k] = search->masks[k - 1];
+            continue;
+        }
+        if(search->base_more) {
+            scan = true;  // Matches beyond the base may qualify
+            break;
+        }
+        char words[SEARCH_QUERY_WORDS][SEARCH_TERM_LEN];
+        int32_t word_count = flipchanger_search_prefix_words(search, k, words);
+        uint32_t mask = 0;
+        for(int32_t i = 0; i < search->base_count; i++) {
+            if(!(search->masks[k - 1] & (1u << i))) continue;
+            const CatalogEntry* entry = &search->base_keys[i];
+            bool all = word_count > 0;
+            for(int32_t w = 0; all && w < word_count; w++) {
+                all = flipchanger_terms_text_matches(entry->artist, words[w]) ||
+                      flipchanger_terms_text_matches(entry->album, words[w]);
+            }
+            if(all) mask |= 1u << i;
+        }
+        search->masks[k] = mask;
+    }
+
+    if(scan) {
+        flipchanger_catalog_lookup(app);
+        char words[SEARCH_QUERY_WORDS][SEARCH_TERM_LEN];
+        // A query without words matches nothing, which nothing can narrow from
+        search->base_len = (flipchanger_search_words(search->query, words) > 0) ? len : -1;
+        search->masks[len] = (search->base_count >= 32) ? 0xFFFFFFFFu : ((1u << search->base_count) - 1);
+    }
+    search->level_count = len + 1;
+    flipchanger_search_list(app);
+    search->pending = false;
+}
+
+/* === Storage worker - owns all SD I/O; input handling and main post StorageRequests to it === */
+
+// Queue a request without waiting: callers hold the app mutex the worker needs to drain the queue
+static bool flipchanger_storage_post(FlipChangerApp* app, StorageRequestType type, int32_t slot_index) {
+    if(!app->storage_queue) return false;
+    StorageRequest request = {.type = type, .slot_index = slot_index};
+    return furi_message_queue_put(app->storage_queue, &request, 0) == FuriStatusOk;
+}
+
+// Registry, then the current Changer's slots; a missing registry gets a Default Changer
+static void flipchanger_storage_startup(FlipChangerApp* app) {
+    flipchanger_load_changers(app);
+    if(app->changer_count == 0 && flipchanger_reserve_changers(app, 1)) {
+        Changer* c = &app->changers[0];
+        strncpy(c->id, "changer_0", CHANGER_ID_LEN - 1);
+        strncpy(c->name, "Default", CHANGER_NAME_LEN - 1);
+        c->location[0] = '\0';
+        c->total_slots = DEFAULT_SLOTS;
+        app->changer_count = 1;
+        app->current_changer_index = 0;
+        strncpy(app->current_changer_id, "changer_0", CHANGER_ID_LEN - 1);
+        app->current_changer_id[CHANGER_ID_LEN - 1] = '\0';
+        flipchanger_save_changers(app);
+    }
+    flipchanger_load_data(app);
+}
+
+// Store and index files kept next to a Changer's slots file; the .json itself is rewritten by create
+static const char* const changer_sidecar_exts[] = {"bin", "jnl", "trk", "sum", "idx", "trm"};
+
+// Remove a Changer's sidecars: ids are reused, and a new Changer must not pick up the old one's data
+static void flipchanger_remove_changer_files(FlipChangerApp* app, const char* changer_id) {
+    char path[64];
+    for(size_t i = 0; i < COUNT_OF(changer_sidecar_exts); i++) {
+        flipchanger_get_changer_path(changer_id, changer_sidecar_exts[i], path, sizeof(path));
+        storage_common_remove(app->storage, path);
+    }
+}
+
+// Empty slots file for a newly added Changer, then the registry listing it
+static bool flipchanger_storage_create_changer(FlipChangerApp* app, int32_t changer_index) {
+    if(changer_index < 0 || changer_index >= app->changer_count) return false;
+    const Changer* changer = &app->changers[changer_index];
+    flipchanger_remove_changer_files(app, changer->id);  // Left over from a deleted Changer with this id
+    char path[64];
+    snprintf(path, sizeof(path), "%s/flipchanger_%s.json", FLIPCHANGER_APP_DIR, changer->id);
+    File* file = storage_file_alloc(app->storage);
+    bool ok = storage_file_open(file, path, FSAM_WRITE, FSOM_CREATE_ALWAYS);
+    if(ok) {
+        char init[80];
+        snprintf(init, sizeof(init), "{\"version\":1,\"total_slots\":%ld,\"slots\":[]}", (long)changer->total_slots);
+        ok = storage_file_write(file, (const uint8_t*)init, strlen(init)) == strlen(init);
+        storage_file_close(file);
+    }
+    storage_file_free(file);
+    return flipchanger_save_changers(app) && ok;
+}
+
+// Everything the exit path used to write from main: nothing is left in RAM only
+static bool flipchanger_storage_flush(FlipChangerApp* app) {
+    bool ok = true;
+    if(app->dirty) ok = flipchanger_save_data(app);
+    if(!app->binary_store) {
+        ok = flipchanger_journal_compact(app) && ok;  // Leave a self-contained JSON file behind
+    } else if(app->json_export_stale) {
+        ok = flipchanger_export_json(app) && ok;  // Keep JSON export current for backups/other tools
+    }
+    return flipchanger_save_changers(app) && ok;
+}
+
+// Run one request; called with the app mutex held. Returns false if the SD write/read failed.
+static bool flipchanger_storage_handle(FlipChangerApp* app, const StorageRequest* request) {
+    if(!app->storage) return false;
+    switch(request->type) {
+        case StorageRequestStartup:
+            flipchanger_storage_startup(app);
+            return true;
+        case StorageRequestSwitchChanger:
+            flipchanger_load_data(app);
+            return flipchanger_save_changers(app);
+        case StorageRequestLoadSlot:
+            if(request->slot_index >= 0 && request->slot_index < MAX_SLOTS) {
+                app->load_pending[request->slot_index / 8] &= ~(1 << (request->slot_index % 8));
+            }
+            flipchanger_update_cache(app, request->slot_index);
+            return flipchanger_get_cached_slot(app, request->slot_index) != NULL;
+        case StorageRequestLoadTracks:
+            return flipchanger_load_tracks(app, request->slot_index);
+        case StorageRequestSaveSlot:
+            return flipchanger_save_slot_to_sd(app, request->slot_index);
+        case StorageRequestSaveAll: {
+            bool ok = !app->dirty || flipchanger_save_data(app);
+            if(ok) app->dirty = false;
+            return flipchanger_save_changers(app) && ok;
+        }
+        case StorageRequestSaveChangers:
+            return flipchanger_save_changers(app);
+        case StorageRequestCreateChanger:
+            app->catalog_todo = -1;  // New Changer: not in the catalog yet
+            return flipchanger_storage_create_changer(app, request->slot_index);
+        case StorageRequestDeleteChanger:
+            flipchanger_remove_changer_files(app, request->changer_id);
+            return true;
+        case StorageRequestToggleStore:
+            return flipchanger_set_binary_store(app, !app->binary_store);
+        case StorageRequestBreakdown:
+            app->breakdown_queued = false;
+            if(app->current_view == VIEW_STATISTICS && !flipchanger_breakdown_step(app)) {
+                flipchanger_breakdown_ready(app);  // Queue the next chunk; input and draw run in between
+            }
+            return true;
+        case StorageRequestTermBuild:
+            if(!app->term_build) return true;
+            app->term_build->queued = false;
+            if(flipchanger_terms_step(app)) {
+                if(app->search && app->search->pending) {
+                    // Query typed meanwhile; a failed rebuild drops it rather than retrying in a loop
+                    if(app->terms_valid) flipchanger_search_run(app);
+                    else app->search->pending = false;
                 }
-                first_track = false;
-                
-                storage_file_write(file, (const uint8_t*)"{", 1);
-                
-                // Track number
-                char track_num[32];
-                snprintf(track_num, sizeof(track_num), "\"num\":%ld,", (long)slot->cd.tracks[t].number);
-                storage_file_write(file, (const uint8_t*)track_num, strlen(track_num));
-                
-                // Track title
-                storage_file_write(file, (const uint8_t*)"\"title\":", 8);
-                write_json_string(file, slot->cd.tracks[t].title);
-                storage_file_write(file, (const uint8_t*)",", 1);
-                
-                // Track duration
-                storage_file_write(file, (const uint8_t*)"\"duration\":", 11);
-                write_json_string(file, slot->cd.tracks[t].duration);
-                
-                storage_file_write(file, (const uint8_t*)"}", 1);
+            } else if(app->search) {
+                flipchanger_terms_ready(app);  // Queue the next chunk while Search is open
             }
-            storage_file_write(file, (const uint8_t*)"],", 2);
-            
-            // Notes
-            storage_file_write(file, (const uint8_t*)"\"notes\":", 8);
-            write_json_string(file, slot->cd.notes);
+            return true;
+        case StorageRequestSearch:
+            flipchanger_search_run(app);
+            return true;
+        case StorageRequestCatalogSync:
+            app->catalog_queued = false;
+            if(flipchanger_catalog_step(app)) {
+                if(app->search && app->search->global && app->search->pending) flipchanger_search_run(app);
+            } else if(app->search && app->search->global) {
+                flipchanger_catalog_ready(app);  // Queue the next Changer while Find Disc is open
+            }
+            return true;
+        case StorageRequestFlush:
+            return flipchanger_storage_flush(app);
+        default:
+            return true;  // Prefetch: waking the worker is all it needs
+    }
+}
+
+/**
+ * Storage thread: sleeps on the request queue and runs each request under the app mutex,
+ * then posts AppEventStorageDone so the main loop redraws (and blinks for confirmed requests).
+ * Slot list prefetch runs in the gaps while it is pending. Stops on StorageRequestStop.
+ */
+static int32_t flipchanger_storage_worker(void* ctx) {
+    FlipChangerApp* app = (FlipChangerApp*)ctx;
+    StorageRequest request;
+    while(true) {
+        uint32_t timeout = (app->prefetch_step != 0) ? PREFETCH_TICK_MS : FuriWaitForever;
+        if(furi_message_queue_get(app->storage_queue, &request, timeout) != FuriStatusOk) {
+            furi_mutex_acquire(app->mutex, FuriWaitForever);
+            flipchanger_prefetch_run(app);
+            furi_mutex_release(app->mutex);
+            continue;
+        }
+        if(request.type == StorageRequestStop) break;
+
+        furi_mutex_acquire(app->mutex, FuriWaitForever);
+        bool ok = flipchanger_storage_handle(app, &request);
+        furi_mutex_release(app->mutex);
+
+        if(request.type != StorageRequestPrefetch) {
+            // No wait: after exit the main loop no longer drains the queue
+            AppEvent event = {.type = AppEventStorageDone, .request = request.type, .ok = ok};
+            furi_message_queue_put(app->event_queue, &event, 0);
         }
-        
-        storage_file_write(file, (const uint8_t*)"}", 1);
     }
-    
-    // Write JSON footer
-    storage_file_write(file, (const uint8_t*)"]}", 2);
-    
-    // Close file (this should flush automatically)
-    bool result = storage_file_close(file);
-    storage_file_free(file);
-    
-    if(result) {
-        app->dirty = false;
+    return 0;
+}
+
+// Worker result, on the main loop: blink for requests the user confirmed, redraw for all
+static void flipchanger_storage_done(FlipChangerApp* app, const AppEvent* event) {
+    if(event->request == StorageRequestStartup || event->request == StorageRequestSaveSlot ||
+       event->request == StorageRequestToggleStore) {
+        notification_message(app->notifications, event->ok ? &sequence_blink_green_100 : &sequence_blink_red_100);
     }
-    
-    return result;
+    view_port_update(app->view_port);
 }
 
 /* === View drawing functions === */
@@ -777,6 +4571,7 @@ void flipchanger_draw_statistics(Canvas* canvas, FlipChangerApp* app);
 void flipchanger_draw_changers(Canvas* canvas, FlipChangerApp* app);
 void flipchanger_draw_add_edit_changer(Canvas* canvas, FlipChangerApp* app);
 void flipchanger_draw_confirm_delete_changer(Canvas* canvas, FlipChangerApp* app);
+void flipchanger_draw_search(Canvas* canvas, FlipChangerApp* app);
 
 // Draw main menu (scrollable - 5 visible at a time)
 void flipchanger_draw_main_menu(Canvas* canvas, FlipChangerApp* app) {
@@ -793,13 +4588,15 @@ void flipchanger_draw_main_menu(Canvas* canvas, FlipChangerApp* app) {
     canvas_set_font(canvas, FontSecondary);
     const char* menu_items[] = {
         "View Slots",
+        "Search",
+        "Find Disc",
         "Add CD",
         "Settings",
         "Statistics",
         "Changers",
         "Help"
     };
-    const int32_t main_menu_count = 6;
+    const int32_t main_menu_count = 8;
     const int32_t visible_count = 5;
     int32_t selected = ((app->selected_index % main_menu_count) + main_menu_count) % main_menu_count;
 
@@ -940,25 +4737,126 @@ void flipchanger_draw_confirm_delete_changer(Canvas* canvas, FlipChangerApp* app
     canvas_draw_str(canvas, 5, 40, "OK=Yes  Back=No");
 }
 
+// Draw Search view: query with character picker, then the matching slots (from the summary;
+// Find Disc rows come from the catalog and name the Changer). Results follow the query as it
+// is typed; the previous ones stay up while the worker narrows them.
+void flipchanger_draw_search(Canvas* canvas, FlipChangerApp* app) {
+    canvas_clear(canvas);
+    canvas_set_font(canvas, FontPrimary);
+    SearchState* search = app->search;
+    canvas_draw_str(canvas, 5, 8, (search && search->global) ? "Find Disc" : "Search");
+    if(!search) return;
+
+    canvas_set_font(canvas, FontSecondary);
+    if(search->searched && !search->pending) {
+        char count[16];
+        snprintf(count, sizeof(count), "%ld%s found", (long)search->match_count, (search->global && search->more) ? "+" : "");
+        canvas_draw_str(canvas, 75, 8, count);
+    }
+    canvas_draw_str(canvas, 5, 18, "Find:");
+    canvas_draw_str(canvas, 30, 18, search->query[0] ? search->query : "-");
+    if(!search->in_results) {
+        char cd[8];
+        int32_t cs = app->edit_char_selection;
+        if(cs >= CHAR_DEL_INDEX) snprintf(cd, sizeof(cd), "[DEL]");
+        else snprintf(cd, sizeof(cd), "[%c]", CHAR_SET[cs % (strlen(CHAR_SET) + 1)]);
+        canvas_draw_str(canvas, 100, 18, cd);
+    }
+
+    if(search->global && app->catalog_todo != 0) {
+        char progress[32];
+        if(app->catalog_todo > 0) {
+            snprintf(progress, sizeof(progress), "Cataloging %ld Changer%s", (long)app->catalog_todo, app->catalog_todo > 1 ? "s" : "");
+        } else {
+            snprintf(progress, sizeof(progress), "Cataloging...");
+        }
+        canvas_draw_str(canvas, 5, 32, progress);
+        return;
+    }
+    if(!search->global && app->term_build) {
+        char progress[32];
+        snprintf(progress, sizeof(progress), "Indexing %ld/%ld", (long)app->term_build->scanned, (long)app->total_slots);
+        canvas_draw_str(canvas, 5, 32, progress);
+        return;
+    }
+    char words[SEARCH_QUERY_WORDS][SEARCH_TERM_LEN];
+    if(flipchanger_search_words(search->query, words) == 0) {
+        canvas_draw_str(canvas, 5, 32, "OK=Add  Right=Results");
+        return;
+    }
+    if(search->pending && search->hit_count == 0) {
+        canvas_draw_str(canvas, 5, 32, "Searching...");
+        return;
+    }
+    if(search->hit_count == 0) {
+        canvas_draw_str(canvas, 5, 32, "No matches");
+        return;
+    }
+
+    const int32_t visible = 4;
+    int32_t start = search->selected - visible + 1;
+    if(start < 0) start = 0;
+    int32_t y = 29;
+    for(int32_t i = start; i < search->hit_count && i < start + visible; i++) {
+        int32_t slot_index = search->hits[i];
+        bool sel = search->in_results && (i == search->selected);
+        if(sel) {
+            canvas_draw_box(canvas, 2, y - 8, 124, 9);
+            canvas_invert_color(canvas);
+        }
+        char line[40];
+        if(search->global) {
+            // Changer name (cut short), slot, catalog keys
+            const char* name = (search->hit_changers[i] < app->changer_count) ? app->changers[search->hit_changers[i]].name : "?";
+            snprintf(line, sizeof(line), "%.6s %ld %s", name, (long)(slot_index + 1), search->hit_labels[i]);
+        } else {
+            const SlotSummary* row = &app->summary[slot_index];
+            snprintf(line, sizeof(line), "%ld %s - %s", (long)(slot_index + 1), row->artist, row->album);
+        }
+        bool track_hit = search->hit_fields[i] >= SEARCH_FIELD_TRACK && search->hit_fields[i] != 0xFF;
+        if(track_hit) line[20] = '\0';  // Room for the track number on the right
+        canvas_draw_str(canvas, 5, y, line);
+        if(track_hit) {
+            char track[8];
+            snprintf(track, sizeof(track), "T%ld", (long)(search->hit_fields[i] - SEARCH_FIELD_TRACK + 1));
+            canvas_draw_str(canvas, 110, y, track);
+        }
+        if(sel) {
+            canvas_invert_color(canvas);
+        }
+        y += 10;
+    }
+}
+
 // Draw slot list
 void flipchanger_draw_slot_list(Canvas* canvas, FlipChangerApp* app) {
     canvas_clear(canvas);
     canvas_set_font(canvas, FontPrimary);
     
-    // Header - compact
+    // Header - compact; sorted modes name their order and list occupied slots only
+    static const char* const sort_names[SortModeCount] = {"Slots", "Artist", "Album", "Year", "Genre"};
+    int32_t rows = flipchanger_list_rows(app);
     char header[32];
-    snprintf(header, sizeof(header), "Slots (%ld total)", app->total_slots);
+    if(app->sort_mode == SortModeSlot) {
+        snprintf(header, sizeof(header), "Slots (%ld total)", app->total_slots);
+    } else {
+        snprintf(header, sizeof(header), "By %s (%ld CDs)", sort_names[app->sort_mode % SortModeCount], (long)rows);
+    }
     canvas_draw_str(canvas, 5, 8, header);
     
     // Full screen: 5 slots visible (was 4 when footer reserved space)
     int32_t visible_count = 5;
     int32_t start_index = app->scroll_offset;
     int32_t end_index = start_index + visible_count;
-    if(end_index > app->total_slots) {
-        end_index = app->total_slots;
+    if(end_index > rows) {
+        end_index = rows;
     }
     
     canvas_set_font(canvas, FontSecondary);
+    if(rows == 0) {
+        canvas_draw_str(canvas, 5, 30, "No CDs. Left: order");
+        return;
+    }
     int32_t y = 16;
     
     int32_t items_to_show = (end_index - start_index);
@@ -969,15 +4867,32 @@ void flipchanger_draw_slot_list(Canvas* canvas, FlipChangerApp* app) {
     
     for(int32_t i = start_index; i < end_index && (i - start_index) < 5; i++) {
         char line[80];  // Increased buffer size
-        Slot* slot = flipchanger_get_slot(app, i);
+        int32_t slot_index = flipchanger_list_slot(app, i);
+        // Cached slots show live (possibly unsaved) data; every other row comes from the summary
+        const CachedSlot* slot = flipchanger_get_cached_slot(app, slot_index);
+        SlotSummary row;
+        if(slot) {
+            flipchanger_summary_row_cached(slot, &row);
+        } else {
+            row = app->summary[slot_index];
+        }
         
-        if(slot && slot->occupied) {
-            // Truncate artist name if too long to fit
-            char artist_short[40];
-            snprintf(artist_short, sizeof(artist_short), "%.39s", slot->cd.artist);
-            snprintf(line, sizeof(line), "%ld: %s", (long)(i + 1), artist_short);
+        if(row.occupied && app->sort_mode == SortModeAlbum) {
+            snprintf(line, sizeof(line), "%ld: %s - %s", (long)(slot_index + 1), row.album, row.artist);
+        } else if(row.occupied && app->sort_mode == SortModeYear) {
+            if(row.year > 0) {
+                snprintf(line, sizeof(line), "%ld: %ld %s", (long)(slot_index + 1), (long)row.year, row.artist);
+            } else {
+                snprintf(line, sizeof(line), "%ld: ---- %s", (long)(slot_index + 1), row.artist);
+            }
+        } else if(row.occupied && app->sort_mode == SortModeGenre) {
+            snprintf(line, sizeof(line), "%ld: %s %s", (long)(slot_index + 1), row.genre[0] ? row.genre : "-", row.artist);
+        } else if(row.occupied && row.album[0] != '\0') {
+            snprintf(line, sizeof(line), "%ld: %s - %s", (long)(slot_index + 1), row.artist, row.album);
+        } else if(row.occupied) {
+            snprintf(line, sizeof(line), "%ld: %s", (long)(slot_index + 1), row.artist);
         } else {
-            snprintf(line, sizeof(line), "%ld: [Empty]", (long)(i + 1));
+            snprintf(line, sizeof(line), "%ld: [Empty]", (long)(slot_index + 1));
         }
         
         if(i == app->selected_index) {
@@ -1005,8 +4920,11 @@ void flipchanger_draw_slot_details(Canvas* canvas, FlipChangerApp* app) {
         return;
     }
     
-    Slot* slot = flipchanger_get_slot(app, app->current_slot_index);
-    
+    // Not cached: the lookup queues the load and the worker redraws once it is in
+    Slot* slot = NULL;
+    if(flipchanger_lookup_slot(app, app->current_slot_index, NULL) == SlotLookupReady) {
+        slot = flipchanger_get_slot(app, app->current_slot_index);
+    }
     if(!slot) {
         canvas_set_font(canvas, FontPrimary);
         canvas_draw_str(canvas, 5, 30, "Loading. Press Back.");
@@ -1087,8 +5005,16 @@ void flipchanger_draw_slot_details(Canvas* canvas, FlipChangerApp* app) {
         field_count++;
     }
     if(slot->cd.track_count > 0) {
+        // Runtime was totalled when the tracks were parsed or edited - only formatted here
+        char runtime[12];
+        flipchanger_format_duration(slot->cd.total_seconds, runtime, sizeof(runtime));
         fields[field_count].label = "Tracks:";
-        snprintf(fields[field_count].value, sizeof(fields[field_count].value), "%ld", (long)slot->cd.track_count);
+        snprintf(
+            fields[field_count].value,
+            sizeof(fields[field_count].value),
+            runtime[0] ? "%ld (%s)" : "%ld",
+            (long)slot->cd.track_count,
+            runtime);
         fields[field_count].visible = true;
         field_count++;
     }
@@ -1118,12 +5044,16 @@ void flipchanger_draw_help(Canvas* canvas, FlipChangerApp* app) {
     canvas_set_font(canvas, FontSecondary);
     canvas_draw_str(canvas, 5, 18, "U/D:Select  K:OK  B:Back");
     canvas_draw_str(canvas, 5, 27, "LB:Long Back  R:Help");
-    canvas_draw_str(canvas, 5, 36, "Slots: wrap U/D");
-    canvas_draw_str(canvas, 5, 45, "LPU/LPD: skip 10");
+    canvas_draw_str(canvas, 5, 36, "Slots: wrap U/D  L:order");
+    canvas_draw_str(canvas, 5, 45, "LPU/D:skip 10 LPL/R:free");
     canvas_draw_str(canvas, 5, 54, "B or K: close");
 }
 
 // Draw callback
+static void flipchanger_draw(Canvas* canvas, FlipChangerApp* app);
+static void flipchanger_handle_input(InputEvent* input_event, FlipChangerApp* app);
+
+// GUI callbacks never wait on the SD card: the storage worker holds the app mutex through each request
 void flipchanger_draw_callback(Canvas* canvas, void* ctx) {
     FlipChangerApp* app = (FlipChangerApp*)ctx;
     
@@ -1132,6 +5062,37 @@ void flipchanger_draw_callback(Canvas* canvas, void* ctx) {
         canvas_clear(canvas);
         return;
     }
+    if(furi_mutex_acquire(app->mutex, DRAW_LOCK_WAIT_MS) != FuriStatusOk) {
+        // Worker mid-request; it redraws when done
+        canvas_clear(canvas);
+        canvas_set_font(canvas, FontPrimary);
+        canvas_draw_str(canvas, 5, 30, "Working...");
+        return;
+    }
+    flipchanger_draw(canvas, app);
+    furi_mutex_release(app->mutex);
+}
+
+void flipchanger_input_callback(InputEvent* input_event, void* ctx) {
+    FlipChangerApp* app = (FlipChangerApp*)ctx;
+    
+    // Safety check - don't process input if app is exiting
+    if(!app || !app->running) {
+        return;
+    }
+    // Handled by the main loop; dropped if the queue is full
+    AppEvent event = {.type = AppEventInput, .input = *input_event};
+    furi_message_queue_put(app->event_queue, &event, 0);
+}
+
+// Splash timer callback (timer thread)
+static void flipchanger_splash_timer_callback(void* ctx) {
+    FlipChangerApp* app = (FlipChangerApp*)ctx;
+    AppEvent event = {.type = AppEventSplashDone};
+    furi_message_queue_put(app->event_queue, &event, 0);
+}
+
+static void flipchanger_draw(Canvas* canvas, FlipChangerApp* app) {
     
     switch(app->current_view) {
         case VIEW_MAIN_MENU:
@@ -1174,6 +5135,9 @@ void flipchanger_draw_callback(Canvas* canvas, void* ctx) {
         case VIEW_HELP:
             flipchanger_draw_help(canvas, app);
             break;
+        case VIEW_SEARCH:
+            flipchanger_draw_search(canvas, app);
+            break;
         default:
             canvas_clear(canvas);
             canvas_set_font(canvas, FontPrimary);
@@ -1184,6 +5148,9 @@ void flipchanger_draw_callback(Canvas* canvas, void* ctx) {
 
 // Navigation functions
 void flipchanger_show_main_menu(FlipChangerApp* app) {
+    // Search results are kept while a slot opened from them is shown, not past the menu
+    free(app->search);
+    app->search = NULL;
     app->current_view = VIEW_MAIN_MENU;
     app->selected_index = 0;
     app->scroll_offset = 0;
@@ -1231,6 +5198,7 @@ void flipchanger_show_slot_list(FlipChangerApp* app) {
     app->current_view = VIEW_SLOT_LIST;
     app->selected_index = 0;
     app->scroll_offset = 0;
+    flipchanger_prefetch_note(app, 1);
 }
 
 void flipchanger_show_slot_details(FlipChangerApp* app, int32_t slot_index) {
@@ -1239,6 +5207,34 @@ void flipchanger_show_slot_details(FlipChangerApp* app, int32_t slot_index) {
     app->details_scroll_offset = 0;
 }
 
+// Open Search (global: Find Disc, across Changers) with an empty query; starts the term index
+// rebuild, or the catalog import of Changers missing from it, if needed
+void flipchanger_show_search(FlipChangerApp* app, bool global) {
+    if(!app->search) {
+        app->search = malloc(sizeof(SearchState));
+        if(!app->search) return;
+        memset(app->search, 0, sizeof(SearchState));
+        app->search->global = global;
+        app->search->base_len = -1;
+    }
+    app->current_view = VIEW_SEARCH;
+    app->edit_char_selection = 0;
+    if(app->search->global) {
+        flipchanger_catalog_ready(app);
+    } else {
+        flipchanger_terms_ready(app);
+    }
+}
+
+// Make changer_index the current Changer; its slots load on the worker
+static void flipchanger_switch_changer(FlipChangerApp* app, int32_t changer_index) {
+    app->current_changer_index = changer_index;
+    strncpy(app->current_changer_id, app->changers[changer_index].id, CHANGER_ID_LEN - 1);
+    app->current_changer_id[CHANGER_ID_LEN - 1] = '\0';
+    app->total_slots = app->changers[changer_index].total_slots;
+    flipchanger_storage_post(app, StorageRequestSwitchChanger, -1);
+}
+
 void flipchanger_show_add_edit(FlipChangerApp* app, int32_t slot_index, bool is_new) {
     app->current_view = VIEW_ADD_EDIT_CD;
     app->current_slot_index = slot_index;
@@ -1250,9 +5246,9 @@ void flipchanger_show_add_edit(FlipChangerApp* app, int32_t slot_index, bool is_
     app->editing_track = false;
     app->edit_track_field = TRACK_FIELD_TITLE;
     
-    // Ensure slot is in cache
-    flipchanger_update_cache(app, slot_index);
+    // Opened from details, so normally cached; otherwise the worker loads it (view shows Loading)
     Slot* slot = flipchanger_get_slot(app, slot_index);
+    if(!slot) flipchanger_lookup_slot(app, slot_index, NULL);
     
     if(slot && is_new) {
         // Initialize new slot
@@ -1286,7 +5282,10 @@ void flipchanger_draw_add_edit(Canvas* canvas, FlipChangerApp* app) {
         return;
     }
     
-    Slot* slot = flipchanger_get_slot(app, app->current_slot_index);
+    Slot* slot = NULL;
+    if(flipchanger_lookup_slot(app, app->current_slot_index, NULL) == SlotLookupReady) {
+        slot = flipchanger_get_slot(app, app->current_slot_index);
+    }
     if(!slot) {
         canvas_set_font(canvas, FontPrimary);
         canvas_draw_str(canvas, 5, 30, "Loading. Press Back.");
@@ -1561,8 +5560,12 @@ void flipchanger_draw_track_management(Canvas* canvas, FlipChangerApp* app) {
         return;
     }
     
-    Slot* slot = flipchanger_get_slot(app, app->current_slot_index);
-    if(!slot) {
+    Slot* slot = NULL;
+    if(flipchanger_lookup_slot(app, app->current_slot_index, NULL) == SlotLookupReady) {
+        slot = flipchanger_get_slot(app, app->current_slot_index);
+    }
+    TrackList* tracks = flipchanger_get_tracks(app, app->current_slot_index);
+    if(!slot || !tracks) {
         canvas_set_font(canvas, FontPrimary);
         canvas_draw_str(canvas, 5, 30, "Loading. Press Back.");
         return;
@@ -1606,13 +5609,15 @@ void flipchanger_draw_track_management(Canvas* canvas, FlipChangerApp* app) {
         // Track number and title - ensure track pointer is valid
         char track_line[80];
         if(i >= 0 && i < MAX_TRACKS) {
-            Track* track = &slot->cd.tracks[i];
+            Track* track = &tracks->tracks[i];
             snprintf(track_line, sizeof(track_line), "%ld. %s", (long)track->number, track->title);
             canvas_draw_str(canvas, 5, y, track_line);
             
             // Duration on right
-            if(strlen(track->duration) > 0) {
-                canvas_draw_str(canvas, 100, y, track->duration);
+            if(track->seconds > 0) {
+                char duration[12];
+                flipchanger_format_duration(track->seconds, duration, sizeof(duration));
+                canvas_draw_str(canvas, 100, y, duration);
             }
         }
         
@@ -1625,7 +5630,7 @@ void flipchanger_draw_track_management(Canvas* canvas, FlipChangerApp* app) {
     
     // Show editing interface if editing a track (use bottom area)
     if(app->editing_track && app->edit_selected_track >= 0 && app->edit_selected_track < slot->cd.track_count) {
-        Track* track = &slot->cd.tracks[app->edit_selected_track];
+        Track* track = &tracks->tracks[app->edit_selected_track];
         if(track) {
             canvas_set_font(canvas, FontSecondary);
             int32_t edit_y = 56;  // Bottom area for edit UI (when 4 tracks shown)
@@ -1678,9 +5683,10 @@ void flipchanger_draw_track_management(Canvas* canvas, FlipChangerApp* app) {
                     canvas_draw_str(canvas, 100, edit_y, char_display);
                 }
             } else {
-                // Duration field - numeric only (seconds)
-                canvas_draw_str(canvas, 5, edit_y, "Duration (sec):");
-                char* field = track->duration;
+                // Duration field - digits fill m:ss from the right
+                canvas_draw_str(canvas, 5, edit_y, "Time (m:ss):");
+                char field[12];
+                flipchanger_format_duration(track->seconds, field, sizeof(field));
                 
                 // Display duration value
                 canvas_draw_str(canvas, 70, edit_y, field);
@@ -1699,17 +5705,16 @@ void flipchanger_draw_track_management(Canvas* canvas, FlipChangerApp* app) {
 
 // Input callback
 /* === Input handling - routes to view-specific handlers === */
-void flipchanger_input_callback(InputEvent* input_event, void* ctx) {
-    FlipChangerApp* app = (FlipChangerApp*)ctx;
-    
-    // Safety check - don't process input if app is exiting
-    if(!app || !app->running) {
-        return;
-    }
-    
+static void flipchanger_handle_input(InputEvent* input_event, FlipChangerApp* app) {
     // Handle both short press and long press
     bool is_long_press = (input_event->type == InputTypeLong || input_event->type == InputTypeRepeat);
     bool is_short_press = (input_event->type == InputTypePress);
+    // Left/Right in the slot list also have a long press (free slots), so their short
+    // action waits for the release instead of firing on press
+    bool is_side_key = (input_event->key == InputKeyLeft || input_event->key == InputKeyRight);
+    bool is_list_side = (app->current_view == VIEW_SLOT_LIST && is_side_key);
+    if(is_list_side && is_short_press) return;
+    if(is_list_side && input_event->type == InputTypeShort) is_short_press = true;
     
     if(!is_short_press && !is_long_press) {
         return;
@@ -1722,7 +5727,7 @@ void flipchanger_input_callback(InputEvent* input_event, void* ctx) {
     
     switch(app->current_view) {
         case VIEW_MAIN_MENU: {
-            const int32_t main_menu_count = 6;
+            const int32_t main_menu_count = 8;
             const int32_t visible_count = 5;
             if(input_event->key == InputKeyUp) {
                 app->selected_index = (app->selected_index + main_menu_count - 1) % main_menu_count;
@@ -1738,22 +5743,36 @@ void flipchanger_input_callback(InputEvent* input_event, void* ctx) {
                         flipchanger_show_slot_list(app);
                         break;
                     case 1:
-                        flipchanger_show_slot_list(app);
+                        flipchanger_show_search(app, false);
                         break;
                     case 2:
+                        flipchanger_show_search(app, true);
+                        break;
+                    case 3: {
+                        // Add CD: land on the first free slot (slot order), found in the occupancy bitmap
+                        int32_t free_slot = flipchanger_find_free(app, -1, 1);
+                        app->sort_mode = SortModeSlot;
+                        flipchanger_show_slot_list(app);
+                        if(free_slot >= 0) {
+                            app->selected_index = free_slot;
+                            app->scroll_offset = (free_slot > 4) ? free_slot - 4 : 0;
+                        }
+                        break;
+                    }
+                    case 4:
                         app->current_view = VIEW_SETTINGS;
                         app->selected_index = 0;
                         app->editing_slot_count = false;
                         app->edit_slot_count_pos = 0;
                         break;
-                    case 3:
+                    case 5:
                         app->current_view = VIEW_STATISTICS;
                         app->selected_index = 0;
                         break;
-                    case 4:
+                    case 6:
                         flipchanger_show_changers(app);
                         break;
-                    case 5:
+                    case 7:
                         app->help_return_view = VIEW_MAIN_MENU;
                         app->current_view = VIEW_HELP;
                         break;
@@ -1764,6 +5783,68 @@ void flipchanger_input_callback(InputEvent* input_event, void* ctx) {
             }
             break;
         }
+        case VIEW_SEARCH: {
+            SearchState* search = app->search;
+            if(!search) {
+                flipchanger_show_main_menu(app);
+                break;
+            }
+            if(search->in_results) {
+                // Results: Up/Down select, OK opens the slot, Left/Back return to the query
+                if(input_event->key == InputKeyUp && search->hit_count > 0) {
+                    search->selected = (search->selected + search->hit_count - 1) % search->hit_count;
+                } else if(input_event->key == InputKeyDown && search->hit_count > 0) {
+                    search->selected = (search->selected + 1) % search->hit_count;
+                } else if(input_event->key == InputKeyOk && search->hit_count > 0 && !search->pending) {
+                    int32_t slot_index = search->hits[search->selected];
+                    int32_t changer_index = search->hit_changers[search->selected];
+                    if(search->global && changer_index != app->current_changer_index &&
+                       changer_index < app->changer_count) {
+                        // Disc in another Changer: switch to it and land on the slot in its list
+                        free(app->search);
+                        app->search = NULL;
+                        flipchanger_switch_changer(app, changer_index);
+                        app->sort_mode = SortModeSlot;  // Its orders load with the Changer
+                        flipchanger_show_slot_list(app);
+                        app->selected_index = slot_index;
+                        app->scroll_offset = (slot_index > 4) ? slot_index - 4 : 0;
+                    } else {
+                        flipchanger_lookup_slot(app, slot_index, NULL);
+                        flipchanger_show_slot_details(app, slot_index);
+                    }
+                } else if(input_event->key == InputKeyLeft || input_event->key == InputKeyBack) {
+                    search->in_results = false;
+                }
+                break;
+            }
+
+            int32_t len = strlen(search->query);
+            if(input_event->key == InputKeyUp) {
+                app->edit_char_selection--;
+                if(app->edit_char_selection < 0) app->edit_char_selection = CHAR_DEL_INDEX;
+            } else if(input_event->key == InputKeyDown) {
+                app->edit_char_selection++;
+                if(app->edit_char_selection > CHAR_DEL_INDEX) app->edit_char_selection = 0;
+            } else if(input_event->key == InputKeyOk) {
+                if(app->edit_char_selection >= CHAR_DEL_INDEX) {
+                    if(len > 0) search->query[len - 1] = '\0';
+                } else if(len < SEARCH_QUERY_LEN - 1) {
+                    search->query[len] = CHAR_SET[app->edit_char_selection];
+                    search->query[len + 1] = '\0';
+                }
+                flipchanger_search_typed(app);
+            } else if(input_event->key == InputKeyRight) {
+                search->in_results = search->hit_count > 0;
+            } else if(input_event->key == InputKeyBack) {
+                if(is_short_press && len > 0) {
+                    search->query[len - 1] = '\0';
+                    flipchanger_search_typed(app);
+                } else {
+                    flipchanger_show_main_menu(app);
+                }
+            }
+            break;
+        }
         case VIEW_CHANGERS: {
             bool show_add = (app->changer_count < MAX_CHANGERS);
             int32_t total_rows = app->changer_count + (show_add ? 1 : 0);
@@ -1788,11 +5869,7 @@ void flipchanger_input_callback(InputEvent* input_event, void* ctx) {
                 } else if(is_long_press && app->selected_index < app->changer_count) {
                     flipchanger_show_add_edit_changer(app, app->selected_index);
                 } else if(app->selected_index >= 0 && app->selected_index < app->changer_count) {
-                    app->current_changer_index = app->selected_index;
-                    strncpy(app->current_changer_id, app->changers[app->selected_index].id, CHANGER_ID_LEN - 1);
-                    app->current_changer_id[CHANGER_ID_LEN - 1] = '\0';
-                    app->total_slots = app->changers[app->selected_index].total_slots;
-                    app->pending_changer_switch = true;
+                    flipchanger_switch_changer(app, app->selected_index);
                     app->scroll_offset = 0;
                     flipchanger_show_main_menu(app);
                 }
@@ -1817,27 +5894,15 @@ void flipchanger_input_callback(InputEvent* input_event, void* ctx) {
                         if(app->current_changer_index == app->edit_changer_index) {
                             app->total_slots = app->edit_changer.total_slots;
                         }
-                    } else {
-                        char id[CHANGER_ID_LEN];
-                        snprintf(id, sizeof(id), "changer_%ld", (long)app->changer_count);
-                        strncpy(app->edit_changer.id, id, CHANGER_ID_LEN - 1);
-                        app->edit_changer.id[CHANGER_ID_LEN - 1] = '\0';
+                        flipchanger_storage_post(app, StorageRequestSaveChangers, -1);
+                    } else if(flipchanger_reserve_changers(app, app->changer_count + 1)) {
+                        flipchanger_new_changer_id(app, app->edit_changer.id);
                         if(app->edit_changer.total_slots < MIN_SLOTS) app->edit_changer.total_slots = MIN_SLOTS;
                         if(app->edit_changer.total_slots > MAX_SLOTS) app->edit_changer.total_slots = MAX_SLOTS;
                         memcpy(&app->changers[app->changer_count], &app->edit_changer, sizeof(Changer));
                         app->changer_count++;
-                        char new_path[64];
-                        snprintf(new_path, sizeof(new_path), "%s/flipchanger_%s.json", FLIPCHANGER_APP_DIR, app->edit_changer.id);
-                        File* nf = storage_file_alloc(app->storage);
-                        if(storage_file_open(nf, new_path, FSAM_WRITE, FSOM_CREATE_ALWAYS)) {
-                            char init[80];
-                            snprintf(init, sizeof(init), "{\"version\":1,\"total_slots\":%ld,\"slots\":[]}", (long)app->edit_changer.total_slots);
-                            storage_file_write(nf, (const uint8_t*)init, strlen(init));
-                            storage_file_close(nf);
-                        }
-                        storage_file_free(nf);
+                        flipchanger_storage_post(app, StorageRequestCreateChanger, app->changer_count - 1);
                     }
-                    flipchanger_save_changers(app);
                     flipchanger_show_changers(app);
                 } else if(input_event->key == InputKeyUp) {
                     app->edit_changer_field = (has_delete ? CHANGER_FIELD_DELETE : CHANGER_FIELD_SLOTS);
@@ -1918,6 +5983,9 @@ void flipchanger_input_callback(InputEvent* input_event, void* ctx) {
         }
         case VIEW_CONFIRM_DELETE_CHANGER:
             if(input_event->key == InputKeyOk && app->edit_changer_index >= 0 && app->changer_count > 1) {
+                StorageRequest remove = {.type = StorageRequestDeleteChanger, .slot_index = -1};
+                strncpy(remove.changer_id, app->changers[app->edit_changer_index].id, CHANGER_ID_LEN - 1);
+                furi_message_queue_put(app->storage_queue, &remove, 0);
                 for(int32_t i = app->edit_changer_index; i < app->changer_count - 1; i++) {
                     memcpy(&app->changers[i], &app->changers[i + 1], sizeof(Changer));
                 }
@@ -1928,8 +5996,7 @@ void flipchanger_input_callback(InputEvent* input_event, void* ctx) {
                     app->current_changer_id[CHANGER_ID_LEN - 1] = '\0';
                     app->total_slots = app->changers[app->current_changer_index].total_slots;
                 }
-                flipchanger_save_changers(app);
-                flipchanger_load_data(app);
+                flipchanger_storage_post(app, StorageRequestSwitchChanger, -1);
                 flipchanger_show_changers(app);
             } else if(input_event->key == InputKeyBack) {
                 app->current_view = VIEW_ADD_EDIT_CHANGER;
@@ -1938,24 +6005,49 @@ void flipchanger_input_callback(InputEvent* input_event, void* ctx) {
         case VIEW_HELP:
             if(input_event->key == InputKeyBack || input_event->key == InputKeyOk) {
                 app->current_view = app->help_return_view;
+                // The worker stops the breakdown pass outside Statistics
+                if(app->current_view == VIEW_STATISTICS && app->selected_index > 0) flipchanger_breakdown_ready(app);
             }
             break;
             
-        case VIEW_SLOT_LIST:
-            if(input_event->key == InputKeyRight) {
+        case VIEW_SLOT_LIST: {
+            int32_t rows = flipchanger_list_rows(app);
+            if(is_long_press && (input_event->key == InputKeyLeft || input_event->key == InputKeyRight)) {
+                // Long Left/Right: previous/next free slot (slot order; keeps going while held)
+                int32_t direction = (input_event->key == InputKeyRight) ? 1 : -1;
+                int32_t from = flipchanger_list_slot(app, app->selected_index);
+                if(from < 0) from = (direction > 0) ? -1 : 0;  // Nothing listed: search the whole Changer
+                int32_t free_slot = flipchanger_find_free(app, from, direction);
+                if(free_slot >= 0) {
+                    app->sort_mode = SortModeSlot;
+                    app->selected_index = free_slot;
+                    if(free_slot < app->scroll_offset || free_slot >= app->scroll_offset + 5) {
+                        app->scroll_offset = (free_slot > 4) ? free_slot - 4 : 0;
+                    }
+                    flipchanger_prefetch_note(app, direction);
+                }
+            } else if(input_event->key == InputKeyRight) {
                 app->help_return_view = VIEW_SLOT_LIST;
                 app->current_view = VIEW_HELP;
-            } else if(input_event->key == InputKeyUp) {
+            } else if(input_event->key == InputKeyLeft) {
+                // Next order; the selected disc stays selected if the new order lists it
+                int32_t slot_index = flipchanger_list_slot(app, app->selected_index);
+                app->sort_mode = (app->sort_mode + 1) % SortModeCount;
+                int32_t row = flipchanger_list_row_of(app, slot_index);
+                app->selected_index = (row >= 0) ? row : 0;
+                app->scroll_offset = (app->selected_index > 4) ? app->selected_index - 4 : 0;
+                flipchanger_prefetch_note(app, 1);
+            } else if(input_event->key == InputKeyUp && rows > 0) {
                 if(is_long_press) {
                     // Long press Up: skip back by 10
                     app->selected_index -= 10;
                     if(app->selected_index < 0) {
-                        app->selected_index = app->total_slots - 1;  // Wrap to last
+                        app->selected_index = rows - 1;  // Wrap to last
                     }
                 } else {
                     // Wrap: at slot 1, Up goes to last slot
                     if(app->selected_index <= 0) {
-                        app->selected_index = app->total_slots - 1;
+                        app->selected_index = rows - 1;
                     } else {
                         app->selected_index--;
                     }
@@ -1966,16 +6058,17 @@ void flipchanger_input_callback(InputEvent* input_event, void* ctx) {
                 } else if(app->selected_index >= app->scroll_offset + 5) {
                     app->scroll_offset = app->selected_index - 4;
                 }
-            } else if(input_event->key == InputKeyDown) {
+                flipchanger_prefetch_note(app, is_long_press ? -10 : -1);
+            } else if(input_event->key == InputKeyDown && rows > 0) {
                 if(is_long_press) {
                     // Long press Down: skip forward by 10
                     app->selected_index += 10;
-                    if(app->selected_index >= app->total_slots) {
+                    if(app->selected_index >= rows) {
                         app->selected_index = 0;  // Wrap to first
                     }
                 } else {
                     // Wrap: at last slot, Down goes to first
-                    if(app->selected_index >= app->total_slots - 1) {
+                    if(app->selected_index >= rows - 1) {
                         app->selected_index = 0;
                     } else {
                         app->selected_index++;
@@ -1987,13 +6080,16 @@ void flipchanger_input_callback(InputEvent* input_event, void* ctx) {
                 } else if(app->selected_index < app->scroll_offset) {
                     app->scroll_offset = app->selected_index;
                 }
-            } else if(input_event->key == InputKeyOk) {
-                flipchanger_update_cache(app, app->selected_index);
-                flipchanger_show_slot_details(app, app->selected_index);
+                flipchanger_prefetch_note(app, is_long_press ? 10 : 1);
+            } else if(input_event->key == InputKeyOk && rows > 0) {
+                int32_t slot_index = flipchanger_list_slot(app, app->selected_index);
+                flipchanger_lookup_slot(app, slot_index, NULL);  // Queues the load on a miss
+                flipchanger_show_slot_details(app, slot_index);
             } else if(input_event->key == InputKeyBack) {
                 flipchanger_show_main_menu(app);
             }
             break;
+        }
             
         case VIEW_SLOT_DETAILS: {
             Slot* slot = flipchanger_get_slot(app, app->current_slot_index);
@@ -2007,7 +6103,12 @@ void flipchanger_input_callback(InputEvent* input_event, void* ctx) {
                     flipchanger_show_add_edit(app, app->current_slot_index, false);
                 }
             } else if(input_event->key == InputKeyBack) {
-                flipchanger_show_slot_list(app);
+                if(app->search) {
+                    app->current_view = VIEW_SEARCH;  // Opened from a search result
+                    flipchanger_search_typed(app);    // Picks up an edit saved from the slot
+                } else {
+                    flipchanger_show_slot_list(app);
+                }
             }
             break;
         }
@@ -2052,8 +6153,9 @@ void flipchanger_input_callback(InputEvent* input_event, void* ctx) {
                     // Save the slot
                     slot->occupied = true;
                     app->dirty = true;
-                    flipchanger_save_slot_to_sd(app, app->current_slot_index);
-                    notification_message(app->notifications, &sequence_blink_green_100);
+                    if(!flipchanger_storage_post(app, StorageRequestSaveSlot, app->current_slot_index)) {
+                        notification_message(app->notifications, &sequence_blink_red_100);  // Saved on exit
+                    }
                     flipchanger_show_slot_details(app, app->current_slot_index);
                 } else if(input_event->key == InputKeyUp) {
                     app->edit_field = FIELD_TRACKS;
@@ -2068,7 +6170,10 @@ void flipchanger_input_callback(InputEvent* input_event, void* ctx) {
             } else if(app->edit_field == FIELD_TRACKS) {
                 // Tracks field selected
                 if(input_event->key == InputKeyOk) {
-                    // Enter track management view
+                    // Enter track management view (the worker reads the track list from SD)
+                    if(!flipchanger_get_tracks(app, app->current_slot_index)) {
+                        flipchanger_storage_post(app, StorageRequestLoadTracks, app->current_slot_index);
+                    }
                     app->current_view = VIEW_TRACK_MANAGEMENT;
                     app->edit_selected_track = 0;
                     app->editing_track = false;
@@ -2384,7 +6489,8 @@ void flipchanger_input_callback(InputEvent* input_event, void* ctx) {
             }
             
             Slot* slot = flipchanger_get_slot(app, app->current_slot_index);
-            if(!slot) {
+            TrackList* tracks = flipchanger_get_tracks(app, app->current_slot_index);
+            if(!slot || !tracks) {
                 if(input_event->key == InputKeyBack) {
                     if(is_long_press) {
                         app->current_view = VIEW_SLOT_LIST;
@@ -2407,7 +6513,7 @@ void flipchanger_input_callback(InputEvent* input_event, void* ctx) {
             
             if(app->editing_track) {
                 // Editing track title or duration
-                Track* track = &slot->cd.tracks[app->edit_selected_track];
+                Track* track = &tracks->tracks[app->edit_selected_track];
                 if(!track) {
                     app->editing_track = false;
                     break;
@@ -2432,13 +6538,16 @@ void flipchanger_input_callback(InputEvent* input_event, void* ctx) {
                 
                 char* field = NULL;
                 int32_t max_len = 0;
+                char duration[12];
                 
                 if(app->edit_track_field == TRACK_FIELD_TITLE) {
                     field = track->title;
                     max_len = MAX_TRACK_TITLE_LENGTH;
                 } else if(app->edit_track_field == TRACK_FIELD_DURATION) {
-                    field = track->duration;
-                    max_len = 16; // Max length for duration string
+                    // Cursor moves over the displayed text; the value itself is seconds
+                    flipchanger_format_duration(track->seconds, duration, sizeof(duration));
+                    field = duration;
+                    max_len = sizeof(duration);
                 }
                 
                 if(!field) {
@@ -2493,20 +6602,12 @@ void flipchanger_input_callback(InputEvent* input_event, void* ctx) {
                     // Add/insert character or DELETE
                     // For duration field, handle numeric input
                     if(app->edit_track_field == TRACK_FIELD_DURATION) {
-                        // Duration is numeric only (seconds)
+                        // Duration is numeric only (digits fill m:ss)
                         if(app->edit_char_selection >= 26 && app->edit_char_selection < 36) {
                             // Number selected (0-9)
                             int32_t digit = app->edit_char_selection - 26;
-                            // Convert duration string to number, add digit, convert back
-                            int32_t current_seconds = 0;
-                            if(strlen(track->duration) > 0) {
-                                current_seconds = atoi(track->duration);
-                            }
-                            current_seconds = current_seconds * 10 + digit;
-                            // Limit to reasonable max (99999 seconds = ~27 hours)
-                            if(current_seconds > 99999) current_seconds = 99999;
-                            snprintf(track->duration, sizeof(track->duration), "%ld", (long)current_seconds);
-                            app->dirty = true;
+                            track->seconds = flipchanger_duration_push_digit(track->seconds, digit);
+                            flipchanger_tracks_edited(app, slot);
                         }
                     } else if(app->edit_char_selection >= CHAR_DEL_INDEX) {
                         // DELETE character at cursor
@@ -2521,7 +6622,7 @@ void flipchanger_input_callback(InputEvent* input_event, void* ctx) {
                                 field[i] = field[i + 1];
                             }
                         }
-                        app->dirty = true;
+                        flipchanger_tracks_edited(app, slot);
                     } else if(app->edit_track_field == TRACK_FIELD_TITLE && 
                               app->edit_char_pos >= 0 && app->edit_char_pos < max_len - 1) {
                         // Insert character (for title field only - duration is numeric)
@@ -2544,7 +6645,7 @@ void flipchanger_input_callback(InputEvent* input_event, void* ctx) {
                                 }
                             }
                         }
-                        app->dirty = true;
+                        flipchanger_tracks_edited(app, slot);
                     }
                 } else if(input_event->key == InputKeyBack) {
                     if(is_long_press) {
@@ -2570,17 +6671,8 @@ void flipchanger_input_callback(InputEvent* input_event, void* ctx) {
                             // Not at start - delete character/digit
                             if(app->edit_track_field == TRACK_FIELD_DURATION) {
                                 // Delete last digit
-                                int32_t current_seconds = 0;
-                                if(strlen(track->duration) > 0) {
-                                    current_seconds = atoi(track->duration);
-                                }
-                                current_seconds = current_seconds / 10;
-                                if(current_seconds > 0) {
-                                    snprintf(track->duration, sizeof(track->duration), "%ld", (long)current_seconds);
-                                } else {
-                                    track->duration[0] = '\0';
-                                }
-                                app->dirty = true;
+                                track->seconds = flipchanger_duration_pop_digit(track->seconds);
+                                flipchanger_tracks_edited(app, slot);
                             } else {
                                 // Delete character in title
                                 int32_t len = strlen(field);
@@ -2590,7 +6682,7 @@ void flipchanger_input_callback(InputEvent* input_event, void* ctx) {
                                     }
                                     app->edit_char_pos--;
                                 }
-                                app->dirty = true;
+                                flipchanger_tracks_edited(app, slot);
                             }
                         }
                     }
@@ -2616,16 +6708,16 @@ void flipchanger_input_callback(InputEvent* input_event, void* ctx) {
                 } else if(input_event->key == InputKeyRight) {
                     // Add new track
                     if(slot->cd.track_count >= 0 && slot->cd.track_count < MAX_TRACKS) {
-                        Track* new_track = &slot->cd.tracks[slot->cd.track_count];
+                        Track* new_track = &tracks->tracks[slot->cd.track_count];
                         if(new_track) {
                             new_track->number = slot->cd.track_count + 1;
                             new_track->title[0] = '\0';
-                            new_track->duration[0] = '\0';
+                            new_track->seconds = 0;
                             slot->cd.track_count++;
                             if(slot->cd.track_count > MAX_TRACKS) slot->cd.track_count = MAX_TRACKS;
                             app->edit_selected_track = slot->cd.track_count - 1;
                             if(app->edit_selected_track < 0) app->edit_selected_track = 0;
-                            app->dirty = true;
+                            flipchanger_tracks_edited(app, slot);
                             if(app->notifications) {
                                 notification_message(app->notifications, &sequence_blink_blue_100);
                             }
@@ -2637,8 +6729,8 @@ void flipchanger_input_callback(InputEvent* input_event, void* ctx) {
                         // Shift tracks down
                         for(int32_t i = app->edit_selected_track; i < slot->cd.track_count - 1 && i < MAX_TRACKS - 1; i++) {
                             if(i + 1 < MAX_TRACKS) {
-                                slot->cd.tracks[i] = slot->cd.tracks[i + 1];
-                                slot->cd.tracks[i].number = i + 1;
+                                tracks->tracks[i] = tracks->tracks[i + 1];
+                                tracks->tracks[i].number = i + 1;
                             }
                         }
                         slot->cd.track_count--;
@@ -2647,7 +6739,7 @@ void flipchanger_input_callback(InputEvent* input_event, void* ctx) {
                             app->edit_selected_track--;
                         }
                         if(app->edit_selected_track < 0) app->edit_selected_track = 0;
-                        app->dirty = true;
+                        flipchanger_tracks_edited(app, slot);
                         if(app->notifications) {
                             notification_message(app->notifications, &sequence_blink_red_100);
                         }
@@ -2690,12 +6782,7 @@ void flipchanger_input_callback(InputEvent* input_event, void* ctx) {
                     app->dirty = true;
                 } else if(input_event->key == InputKeyBack) {
                     if(is_long_press) {
-                        if(app->dirty && app->storage) {
-                            flipchanger_init_slots(app, app->total_slots);
-                            flipchanger_save_data(app);
-                            flipchanger_save_changers(app);
-                            app->dirty = false;
-                        }
+                        if(app->dirty) flipchanger_storage_post(app, StorageRequestSaveAll, -1);
                         app->editing_slot_count = false;
                         flipchanger_show_main_menu(app);
                     } else {
@@ -2708,9 +6795,16 @@ void flipchanger_input_callback(InputEvent* input_event, void* ctx) {
                 if(input_event->key == InputKeyRight) {
                     app->help_return_view = VIEW_SETTINGS;
                     app->current_view = VIEW_HELP;
-                } else if(input_event->key == InputKeyOk) {
+                } else if(input_event->key == InputKeyUp || input_event->key == InputKeyDown) {
+                    app->selected_index = (app->selected_index == 0) ? 1 : 0;
+                } else if(input_event->key == InputKeyOk && app->selected_index == 0) {
                     app->editing_slot_count = true;
                     app->edit_slot_count_pos = 0;
+                } else if(input_event->key == InputKeyOk) {
+                    // Toggle storage format (converts the current Changer's slots file)
+                    if(!flipchanger_storage_post(app, StorageRequestToggleStore, -1)) {
+                        notification_message(app->notifications, &sequence_blink_red_100);
+                    }
                 } else if(input_event->key == InputKeyBack) {
                     if(is_long_press) {
                         app->running = false;
@@ -2727,6 +6821,10 @@ void flipchanger_input_callback(InputEvent* input_event, void* ctx) {
             if(input_event->key == InputKeyRight) {
                 app->help_return_view = VIEW_STATISTICS;
                 app->current_view = VIEW_HELP;
+            } else if(input_event->key == InputKeyDown) {
+                app->selected_index = (app->selected_index + 1) % STATS_PAGE_COUNT;
+            } else if(input_event->key == InputKeyUp) {
+                app->selected_index = (app->selected_index + STATS_PAGE_COUNT - 1) % STATS_PAGE_COUNT;
             } else if(input_event->key == InputKeyBack) {
                 if(is_long_press) {
                     app->running = false;
@@ -2735,6 +6833,8 @@ void flipchanger_input_callback(InputEvent* input_event, void* ctx) {
                     flipchanger_show_main_menu(app);
                 }
             }
+            // Breakdown pages: start the pass, or re-queue a chunk whose post was dropped
+            if(app->current_view == VIEW_STATISTICS && app->selected_index > 0) flipchanger_breakdown_ready(app);
             break;
         }
             
@@ -2762,6 +6862,12 @@ int32_t flipchanger_main(void* p) {
     app->notifications = furi_record_open(RECORD_NOTIFICATION);
     app->running = true;
     app->dirty = false;
+    app->catalog_column = -1;  // Set once the first Changer loads
+    app->catalog_todo = -1;
+    app->mutex = furi_mutex_alloc(FuriMutexTypeNormal);
+    app->event_queue = furi_message_queue_alloc(EVENT_QUEUE_SIZE, sizeof(AppEvent));
+    app->storage_queue = furi_message_queue_alloc(STORAGE_QUEUE_SIZE, sizeof(StorageRequest));
+    app->storage_thread = furi_thread_alloc_ex("FlipChangerStorage", STORAGE_WORKER_STACK, flipchanger_storage_worker, app);
     
     // Create view port
     app->view_port = view_port_alloc();
@@ -2772,40 +6878,30 @@ int32_t flipchanger_main(void* p) {
     gui_add_view_port(app->gui, app->view_port, GuiLayerFullscreen);
     
     app->current_view = VIEW_SPLASH;
-    app->splash_start_tick = furi_get_tick();
-    
-    flipchanger_load_changers(app);
-    if(app->changer_count == 0) {
-        Changer* c = &app->changers[0];
-        strncpy(c->id, "changer_0", CHANGER_ID_LEN - 1);
-        strncpy(c->name, "Default", CHANGER_NAME_LEN - 1);
-        c->location[0] = '\0';
-        c->total_slots = DEFAULT_SLOTS;
-        app->changer_count = 1;
-        app->current_changer_index = 0;
-        strncpy(app->current_changer_id, "changer_0", CHANGER_ID_LEN - 1);
-        app->current_changer_id[CHANGER_ID_LEN - 1] = '\0';
-        flipchanger_save_changers(app);
-    }
+    app->splash_timer = furi_timer_alloc(flipchanger_splash_timer_callback, FuriTimerTypeOnce, app);
+    furi_timer_start(app->splash_timer, furi_ms_to_ticks(SPLASH_DURATION_MS));
     
-    flipchanger_load_data(app);
-    notification_message(app->notifications, &sequence_blink_green_100);
-    view_port_update(app->view_port);
+    // Registry and slots load on the worker while the splash is up
+    furi_thread_start(app->storage_thread);
+    flipchanger_storage_post(app, StorageRequestStartup, -1);
     
-    while(app->running) {
-        if(app->current_view == VIEW_SPLASH) {
-            if(furi_get_tick() - app->splash_start_tick >= 1200) {
-                flipchanger_show_main_menu(app);
-                view_port_update(app->view_port);
-            }
-        } else if(app->pending_changer_switch) {
-            app->pending_changer_switch = false;
-            flipchanger_load_data(app);
-            flipchanger_save_changers(app);
+    // Sleep until input, the splash timer or the storage worker has something for us
+    AppEvent event;
+    while(app->running && furi_message_queue_get(app->event_queue, &event, FuriWaitForever) == FuriStatusOk) {
+        if(event.type == AppEventStorageDone) {
+            flipchanger_storage_done(app, &event);
+            continue;
+        }
+        furi_mutex_acquire(app->mutex, FuriWaitForever);
+        if(event.type == AppEventInput) {
+            flipchanger_handle_input(&event.input, app);
+        } else if(app->current_view == VIEW_SPLASH) {
+            flipchanger_show_main_menu(app);
             view_port_update(app->view_port);
         }
-        furi_delay_ms(100);
+        furi_mutex_release(app->mutex);
     }
+    furi_timer_stop(app->splash_timer);
     
     // Exit cleanup sequence (must be in exact order to prevent crashes)
     
@@ -2823,13 +6919,16 @@ int32_t flipchanger_main(void* p) {
     // 3. Set running to false after view port is removed (redundant but safe)
     app->running = false;
     
-    // 4. Save data NOW (view port removed, but storage/GUI still valid)
-    if(app->dirty && app->storage) {
-        flipchanger_save_data(app);
-    }
-    if(app->storage) {
-        flipchanger_save_changers(app);
-    }
+    // 4. Save data NOW (view port removed, but storage/GUI still valid): the worker flushes
+    //    after any requests still queued, then stops
+    StorageRequest request = {.type = StorageRequestFlush, .slot_index = -1};
+    furi_message_queue_put(app->storage_queue, &request, FuriWaitForever);
+    request.type = StorageRequestStop;
+    furi_message_queue_put(app->storage_queue, &request, FuriWaitForever);
+    furi_thread_join(app->storage_thread);
+    furi_thread_free(app->storage_thread);
+    app->storage_thread = NULL;
+    flipchanger_terms_abort(app);  // Unfinished rebuild: its scratch files go, the next Search starts over
     
     // 5. Free view port
     if(app->view_port) {
@@ -2856,6 +6955,14 @@ int32_t flipchanger_main(void* p) {
     }
     
     // 9. Free app structure
+    furi_message_queue_free(app->storage_queue);
+    furi_timer_free(app->splash_timer);
+    furi_message_queue_free(app->event_queue);
+    furi_mutex_free(app->mutex);
+    flipchanger_arena_free(app);
+    flipchanger_breakdown_reset(app);
+    free(app->search);
+    free(app->changers);
     free(app);
     
     return 0;
@@ -2876,7 +6983,15 @@ void flipchanger_draw_settings(Canvas* canvas, FlipChangerApp* app) {
     int32_t y = 20;
     
     // Slot Count setting
+    bool count_selected = (app->selected_index == 0 && !app->editing_slot_count);
+    if(count_selected) {
+        canvas_draw_box(canvas, 2, y - 8, 56, 9);
+        canvas_invert_color(canvas);
+    }
     canvas_draw_str(canvas, 5, y, "Slot Count:");
+    if(count_selected) {
+        canvas_invert_color(canvas);
+    }
     
     // Display current slot count
     char slot_count_str[32];
@@ -2900,60 +7015,87 @@ void flipchanger_draw_settings(Canvas* canvas, FlipChangerApp* app) {
         }
         
         // Show number picker hint
-        canvas_draw_str(canvas, 5, y + 10, "U/D:Num K:Add");
+        canvas_draw_str(canvas, 5, 56, "U/D:Num K:Add");
+    }
+    
+    // Storage format setting
+    y += 12;
+    bool storage_selected = (app->selected_index == 1 && !app->editing_slot_count);
+    if(storage_selected) {
+        canvas_draw_box(canvas, 2, y - 8, 124, 9);
+        canvas_invert_color(canvas);
+    }
+    canvas_draw_str(canvas, 5, y, app->binary_store ? "Storage: Binary" : "Storage: JSON");
+    if(storage_selected) {
+        canvas_invert_color(canvas);
     }
     
     // Range hint - use remaining space
-    y += 14;
+    y += 12;
     canvas_set_font(canvas, FontKeyboard);
     char range_str[32];
     snprintf(range_str, sizeof(range_str), "Range: %d-%d", MIN_SLOTS, MAX_SLOTS);
     canvas_draw_str(canvas, 5, y, range_str);
 }
 
-/**
- * Calculate stats from cached slots only (avoids full JSON parse - stack safety).
- * For 200-slot changer, full parse risks overflow; cache gives partial but safe stats.
- */
-static void flipchanger_calculate_statistics(FlipChangerApp* app, int32_t* total_albums, int32_t* total_tracks, int32_t* total_seconds) {
-    *total_albums = 0;
-    *total_tracks = 0;
-    *total_seconds = 0;
-    
-    if(!app || !app->storage || !total_albums || !total_tracks || !total_seconds) {
+// Top-N page, ranked by guaranteed count (count - error); "+" marks a count that may be higher
+static void flipchanger_draw_stats_table(Canvas* canvas, const StatsCounter* table) {
+    StatsCounter sorted[STATS_TOP_KEYS];
+    memcpy(sorted, table, sizeof(sorted));
+    for(int32_t i = 1; i < STATS_TOP_KEYS; i++) {
+        StatsCounter counter = sorted[i];
+        int32_t j = i;
+        for(; j > 0 && sorted[j - 1].count - sorted[j - 1].error < counter.count - counter.error; j--) sorted[j] = sorted[j - 1];
+        sorted[j] = counter;
+    }
+    int32_t y = 20;
+    for(int32_t i = 0; i < 5 && sorted[i].count > sorted[i].error; i++) {
+        char line[32];  // 10-digit count, "+", two spaces, key
+        snprintf(
+            line,
+            sizeof(line),
+            "%u%s  %.*s",
+            (unsigned)(sorted[i].count - sorted[i].error),
+            sorted[i].error > 0 ? "+" : "",
+            STATS_KEY_LEN - 1,
+            sorted[i].key);
+        canvas_draw_str(canvas, 5, y, line);
+        y += 10;
+    }
+    if(y == 20) canvas_draw_str(canvas, 5, y, "None yet");
+}
+
+// Decade page: one bar per decade from the first to the last one with discs
+static void flipchanger_draw_stats_decades(Canvas* canvas, const CollectionBreakdown* breakdown) {
+    int32_t first = -1;
+    int32_t last = -1;
+    uint16_t peak = 0;
+    for(int32_t i = 0; i < STATS_DECADES; i++) {
+        if(breakdown->decades[i] == 0) continue;
+        if(first < 0) first = i;
+        last = i;
+        if(breakdown->decades[i] > peak) peak = breakdown->decades[i];
+    }
+    if(first < 0) {
+        canvas_draw_str(canvas, 5, 20, "No years yet");
         return;
     }
-    
-    // Use cached slots only for safety (avoids stack overflow from large JSON parsing)
-    // This is more memory-efficient and safer
-    for(int32_t i = 0; i < SLOT_CACHE_SIZE && i < app->total_slots; i++) {
-        Slot* slot = &app->slots[i];
-        if(slot && slot->occupied) {
-            (*total_albums)++;
-            
-            // Count tracks and sum durations
-            if(slot->cd.track_count > 0 && slot->cd.track_count <= MAX_TRACKS) {
-                for(int32_t t = 0; t < slot->cd.track_count; t++) {
-                    Track* track = &slot->cd.tracks[t];
-                    if(track) {
-                        (*total_tracks)++;
-                        
-                        // Parse duration (stored as string, e.g., "180" for 180 seconds)
-                        if(strlen(track->duration) > 0) {
-                            int32_t seconds = atoi(track->duration);
-                            if(seconds > 0 && seconds < 999999) {  // Sanity check
-                                *total_seconds += seconds;
-                            }
-                        }
-                    }
-                }
-            }
-        }
+    int32_t bar_width = 118 / (last - first + 1);
+    if(bar_width > 20) bar_width = 20;
+    for(int32_t i = first; i <= last; i++) {
+        int32_t height = breakdown->decades[i] * 30 / peak;
+        if(breakdown->decades[i] > 0 && height == 0) height = 1;
+        canvas_draw_box(canvas, 5 + (i - first) * bar_width, 46 - height, bar_width - 1, height);
+    }
+    char line[40];
+    snprintf(line, sizeof(line), "%ds-%ds", 1900 + first * 10, 1900 + last * 10);
+    canvas_draw_str(canvas, 5, 56, line);
+    for(int32_t i = first; i <= last; i++) {
+        if(breakdown->decades[i] != peak) continue;
+        snprintf(line, sizeof(line), "Peak %ds: %u", 1900 + i * 10, (unsigned)peak);
+        canvas_draw_str(canvas, 64, 56, line);
+        break;
     }
-    
-    // If we want to count ALL slots (not just cached), we'd need to load from SD card
-    // But that's risky with stack size - for now, count cached slots only
-    // This is safe and won't crash, even if it doesn't show all slots
 }
 
 // Draw Statistics view
@@ -2966,17 +7108,31 @@ void flipchanger_draw_statistics(Canvas* canvas, FlipChangerApp* app) {
     canvas_clear(canvas);
     canvas_set_font(canvas, FontPrimary);
     
-    canvas_draw_str(canvas, 30, 8, "Statistics");
+    // Pages past the totals come from the breakdown pass (storage worker, a chunk at a time)
+    if(app->selected_index > 0) {
+        static const char* titles[STATS_PAGE_COUNT] = {"Statistics", "Top Artists", "Genres", "Decades"};
+        canvas_draw_str(canvas, 30, 8, titles[app->selected_index % STATS_PAGE_COUNT]);
+        canvas_set_font(canvas, FontSecondary);
+        if(!flipchanger_breakdown_done(app)) {
+            char progress[52];  // Room for two 64-bit longs (host builds)
+            snprintf(progress, sizeof(progress), "Counting %ld/%ld", (long)(app->breakdown ? app->breakdown->scanned : 0), (long)app->total_slots);
+            canvas_draw_str(canvas, 5, 30, progress);
+        } else if(app->selected_index == 1) {
+            flipchanger_draw_stats_table(canvas, app->breakdown->artists);
+        } else if(app->selected_index == 2) {
+            flipchanger_draw_stats_table(canvas, app->breakdown->genres);
+        } else {
+            flipchanger_draw_stats_decades(canvas, app->breakdown);
+        }
+        return;
+    }
     
-    // Calculate statistics (safe version - uses cached slots only)
-    int32_t total_albums = 0;
-    int32_t total_tracks = 0;
-    int32_t total_seconds = 0;
+    canvas_draw_str(canvas, 30, 8, "Statistics");
     
-    // Safety: ensure app is valid before calculating
-    if(app && app->storage) {
-        flipchanger_calculate_statistics(app, &total_albums, &total_tracks, &total_seconds);
-    }
+    // Collection totals are kept up to date as slots are saved (summary rows) - nothing to scan
+    int32_t total_albums = app->stats.albums;
+    int32_t total_tracks = app->stats.tracks;
+    int32_t total_seconds = app->stats.seconds;
     
     // Format total time (convert seconds to hours:minutes:seconds)
     int32_t hours = total_seconds / 3600;
@@ -3008,4 +7164,10 @@ void flipchanger_draw_statistics(Canvas* canvas, FlipChangerApp* app) {
         snprintf(time_str, sizeof(time_str), "Time: %lds", (long)seconds);
     }
     canvas_draw_str(canvas, 5, y, time_str);
+    y += 10;
+    
+    // Slot cache effectiveness
+    char cache_str[48];
+    snprintf(cache_str, sizeof(cache_str), "Cache: %lu hit / %lu miss", (unsigned long)app->cache_hits, (unsigned long)app->cache_misses);
+    canvas_draw_str(canvas, 5, y, cache_str);
 }
@@ -2,7 +2,10 @@
  * FlipChanger - Header File
  *
  * Type definitions and function declarations.
- * Storage: flipchanger_changers.json (registry), flipchanger_<id>.json (per-changer slots).
+ * Storage: flipchanger_changers.json (registry), flipchanger_<id>.json (per-changer slots),
+ * optional flipchanger_<id>.bin (fixed-size slot records; JSON is then kept as export),
+ * flipchanger_<id>.trk (track lists, loaded one CD at a time),
+ * flipchanger_<id>.trm (sorted search terms).
  */
 
 #pragma once
@@ -22,8 +25,48 @@
 #define MIN_SLOTS 3
 #define DEFAULT_SLOTS 100  // Default number of slots
 
-// Memory cache - only keep visible slots in RAM
-#define SLOT_CACHE_SIZE 10  // Only keep 10 slots in memory at a time
+// Memory cache - only keep recently used slots in RAM
+#define SLOT_CACHE_SIZE 10  // Slots held at a time; the least recently used one is evicted
+#define SLOT_ARENA_BLOCK 1024  // Cached CD strings are bump-allocated in blocks of this size
+#define SLOT_ARENA_COMPACT_BLOCKS 4  // Edits growing the arena past this many blocks re-pack it
+
+// Slot list prefetch - storage worker reads slots ahead of the cursor while input is idle
+#define PREFETCH_IDLE_MS 40           // Quiet time after a list move before prefetching starts
+#define PREFETCH_TICK_MS 20           // Worker wake-up period while prefetch work is pending
+#define PREFETCH_MAX_DEPTH 4          // Slots read ahead of the cursor (kept below SLOT_CACHE_SIZE)
+#define PREFETCH_HEAP_RESERVE 8192    // Free heap below this: no prefetch
+#define PREFETCH_HEAP_PER_SLOT 1024   // Each further slot of depth needs this much more free heap
+
+// Statistics breakdowns - bounded tables filled by a chunked pass on the storage worker
+#define STATS_TOP_KEYS 8              // Counters per artist/genre table; rarer keys are evicted (Space-Saving)
+#define STATS_KEY_LEN 16              // Table key: upper-cased field prefix, including terminator
+#define STATS_DECADES 20              // Decade histogram buckets: 1900s .. 2090s
+#define STATS_NO_DECADE 0xFF          // Year unknown or out of range
+#define STATS_NO_COUNTER 0xFF         // Slot not counted in a table (no key, or its counter was taken over)
+#define STATS_PASS_CHUNK 10           // Slots counted per worker request (mutex released in between)
+#define STATS_PAGE_COUNT 4            // Statistics pages: totals, top artists, genres, decades (Up/Down)
+
+// Search - words of artist, album and track titles, looked up by binary search in the term index
+#define SEARCH_TERM_LEN 14            // Indexed word prefix, including terminator (longer words are cut)
+#define SEARCH_QUERY_LEN 24           // Query text, including terminator
+#define SEARCH_QUERY_WORDS 3          // Query words that must all match (each as a word prefix)
+#define SEARCH_MAX_HITS 32            // Slots listed per search; further matches are only flagged
+#define SEARCH_DIRTY_LIMIT 16         // Slots saved since the index build are searched from their records; more = rebuild
+#define SEARCH_BUILD_CHUNK 10         // Slots indexed per worker request (mutex released in between)
+#define SEARCH_RUN_ENTRIES 256        // Postings sorted in RAM (4 KB) before the run is merged on SD
+#define SEARCH_MERGE_BUFFER 32        // Postings buffered per file while merging runs
+#define SEARCH_FIELD_ARTIST 0         // TermEntry.field: artist or album artist
+#define SEARCH_FIELD_ALBUM 1
+#define SEARCH_FIELD_TRACK 2          // Plus the track index
+#define SEARCH_LABEL_LEN 24           // Find Disc result text (artist - album), including terminator
+#define CATALOG_READ_ENTRIES 10       // Catalog entries read (or appended) per call, 400-byte buffer
+
+// Storage worker - all SD I/O runs on its own thread, fed by a request queue
+#define STORAGE_WORKER_STACK 4096     // JSON rewrite paths nest deepest; sized apart from the app stack
+#define STORAGE_QUEUE_SIZE 16         // Pending requests; input drops its request when full
+#define EVENT_QUEUE_SIZE 16           // AppEvents waiting for the main loop (posters never wait)
+#define SPLASH_DURATION_MS 1200       // Splash screen time before the main menu (any key skips it)
+#define DRAW_LOCK_WAIT_MS 10          // Draw gives up on the app mutex after this (worker mid-I/O)
 
 // Maximum string lengths
 #define MAX_STRING_LENGTH 64
@@ -39,8 +82,36 @@
 #define FLIPCHANGER_DATA_PATH FLIPCHANGER_APP_DIR "/flipchanger_data.json"
 #define FLIPCHANGER_CHANGERS_PATH FLIPCHANGER_APP_DIR "/flipchanger_changers.json"
 
-// Multi-Changer support
-#define MAX_CHANGERS 10
+// Multi-Changer support - registry array grows on demand up to MAX_CHANGERS
+#define MAX_CHANGERS 64
+#define CHANGERS_INITIAL_CAPACITY 4
+
+// Binary slot store: SlotStoreHeader followed by one fixed-size Slot record per slot
+#define SLOT_STORE_MAGIC 0x43504C46  // "FLPC"
+#define SLOT_STORE_VERSION 1
+// Offset index sidecar: SlotIndexHeader followed by MAX_SLOTS SlotIndexEntry (one per slot)
+#define SLOT_INDEX_MAGIC 0x58444946  // "FIDX"
+#define SLOT_INDEX_VERSION 1
+// Slot summary sidecar: SlotSummaryHeader followed by MAX_SLOTS SlotSummary (list rows without loading CDs)
+#define SLOT_SUMMARY_MAGIC 0x4D555346  // "FSUM"
+#define SLOT_SUMMARY_VERSION 5
+#define SUMMARY_ARTIST_LEN 12  // Prefix kept per slot, including terminator
+#define SUMMARY_ALBUM_LEN 8
+#define SUMMARY_GENRE_LEN 6
+#define SORT_ORDER_COUNT 4     // Slot orders kept after the summary rows: artist, album, year, genre
+// Track store sidecar: TrackStoreHeader followed by one fixed-size TrackList record per slot
+#define TRACK_STORE_MAGIC 0x4B525446  // "FTRK"
+#define TRACK_STORE_VERSION 2  // 1 = durations kept as text (converted on load)
+// Term index sidecar: TermIndexHeader followed by TermEntry postings sorted by term (Search)
+#define TERM_INDEX_MAGIC 0x4D525446  // "FTRM"
+#define TERM_INDEX_VERSION 1
+// Global catalog: CatalogHeader, then one column of MAX_SLOTS CatalogEntry per Changer (Find Disc)
+#define CATALOG_PATH FLIPCHANGER_APP_DIR "/flipchanger_catalog.dat"
+#define CATALOG_MAGIC 0x54414346  // "FCAT"
+#define CATALOG_VERSION 1
+#define CATALOG_KEY_LEN 20  // Normalized artist/album prefix, including terminator
+// Edit journal: appended slot records, folded into the JSON file past this size and on exit
+#define JOURNAL_COMPACT_SIZE 8192
 #define CHANGER_ID_LEN 24
 #define CHANGER_NAME_LEN 33
 #define CHANGER_LOCATION_LEN 33
@@ -57,7 +128,7 @@ typedef struct {
 typedef struct {
     int32_t number;
     char title[MAX_TRACK_TITLE_LENGTH];
-    char duration[16];  // Format: "3:45"
+    uint16_t seconds;  // Duration; parsed once from "m:ss", formatted only when drawn (0 = unknown)
 } Track;
 
 // CD information
@@ -68,11 +139,16 @@ typedef struct {
     int32_t year;
     int32_t disc_number;                  // 0 = not set, 1+ = disc number in set
     char genre[MAX_GENRE_LENGTH];
-    Track tracks[MAX_TRACKS];
-    int32_t track_count;
+    int32_t track_count;                  // Track titles/durations live in the track store
+    int32_t total_seconds;                // Sum of track durations, kept with the header for statistics
     char notes[MAX_NOTES_LENGTH];
 } CD;
 
+// Track list of one CD - loaded on demand (Track Management), never cached per slot
+typedef struct {
+    Track tracks[MAX_TRACKS];
+} TrackList;
+
 // Slot information
 typedef struct {
     int32_t slot_number;
@@ -80,6 +156,272 @@ typedef struct {
     CD cd;
 } Slot;
 
+// Storage worker request (slot_index: slot, or Changer index for CreateChanger; unused otherwise)
+typedef enum {
+    StorageRequestStartup,        // Load the registry (creating a default Changer), then the current Changer
+    StorageRequestSwitchChanger,  // Load the current Changer and record it in the registry
+    StorageRequestLoadSlot,       // Make sure a slot is cached (details / edit opened)
+    StorageRequestLoadTracks,     // Load a slot's track list (Track Management)
+    StorageRequestSaveSlot,       // Write one edited slot (journal line / binary record)
+    StorageRequestSaveAll,        // Full save of dirty slots, then the registry (slot count changed)
+    StorageRequestSaveChangers,   // Write the registry (Changer edited)
+    StorageRequestCreateChanger,  // Create an empty slots file for a new Changer, then the registry
+    StorageRequestDeleteChanger,  // Remove the store and index files of a deleted Changer (changer_id)
+    StorageRequestToggleStore,    // Convert the current Changer between JSON and binary store
+    StorageRequestBreakdown,      // Count the next STATS_PASS_CHUNK slots into the Statistics breakdown
+    StorageRequestTermBuild,      // Index the next SEARCH_BUILD_CHUNK slots of a term index rebuild
+    StorageRequestSearch,         // Look up the Search view's query
+    StorageRequestCatalogSync,    // Import the next Changer missing from the global catalog
+    StorageRequestPrefetch,       // Wake the worker: the slot list moved
+    StorageRequestFlush,          // Exit: save, compact journal, refresh export, registry
+    StorageRequestStop,           // Leave the worker loop
+} StorageRequestType;
+
+typedef struct {
+    StorageRequestType type;
+    int32_t slot_index;
+    char changer_id[CHANGER_ID_LEN];  // DeleteChanger: the Changer already removed from the registry
+} StorageRequest;
+
+// Non-blocking slot lookup result (flipchanger_lookup_slot)
+typedef enum {
+    SlotLookupReady,    // Cached; record returned
+    SlotLookupPending,  // Not cached; the storage worker is loading it and redraws when done
+    SlotLookupInvalid,  // Slot index out of range
+} SlotLookupState;
+
+// Main loop event - the loop sleeps on the event queue until one of these arrives
+typedef enum {
+    AppEventInput,        // Key event from the input callback
+    AppEventSplashDone,   // Splash timer expired
+    AppEventStorageDone,  // Storage worker finished a request (not posted for prefetch)
+} AppEventType;
+
+typedef struct {
+    AppEventType type;
+    InputEvent input;             // AppEventInput
+    StorageRequestType request;   // AppEventStorageDone: request that finished
+    bool ok;                      // AppEventStorageDone: its result
+} AppEvent;
+
+// Cached CD record: numbers inline, strings packed (base-40 over CHAR_SET, raw fallback)
+// in the cache arena. Expanded into a full Slot only for the slot being viewed or edited.
+typedef struct {
+    int32_t slot_number;  // 1-based key, 0 = free entry
+    bool occupied;
+    bool dirty;           // Edited since it was last written; written back on eviction
+    uint32_t last_used;   // cache_clock at last use (LRU eviction)
+    int32_t year;
+    int32_t disc_number;
+    int32_t track_count;
+    int32_t total_seconds;
+    const uint8_t* artist;
+    const uint8_t* album_artist;
+    const uint8_t* album;
+    const uint8_t* genre;
+    const uint8_t* notes;
+} CachedSlot;
+
+// One block of the cache string arena; another is chained on when it fills up
+typedef struct SlotArenaBlock {
+    struct SlotArenaBlock* next;
+    size_t used;
+    char data[SLOT_ARENA_BLOCK];
+} SlotArenaBlock;
+
+// Header of flipchanger_<id>.bin; record N lives at sizeof(header) + N * record_size
+typedef struct {
+    uint32_t magic;        // SLOT_STORE_MAGIC
+    uint16_t version;      // SLOT_STORE_VERSION
+    uint16_t header_size;  // sizeof(SlotStoreHeader)
+    uint32_t record_size;  // sizeof(Slot) - file is rebuilt from JSON if layout changes
+    int32_t total_slots;
+} SlotStoreHeader;
+
+// Header of flipchanger_<id>.trk; record N lives at sizeof(header) + N * record_size
+typedef struct {
+    uint32_t magic;        // TRACK_STORE_MAGIC
+    uint16_t version;      // TRACK_STORE_VERSION
+    uint16_t header_size;  // sizeof(TrackStoreHeader)
+    uint32_t record_size;  // sizeof(TrackList) - file is rebuilt if MAX_TRACKS changes
+} TrackStoreHeader;
+
+// Header of flipchanger_<id>.idx; only trusted while json_size/json_mtime match the JSON file
+typedef struct {
+    uint32_t magic;          // SLOT_INDEX_MAGIC
+    uint16_t version;        // SLOT_INDEX_VERSION
+    uint16_t entry_count;    // MAX_SLOTS
+    uint32_t json_size;
+    uint32_t json_mtime;
+    int32_t total_slots;
+    uint32_t array_end;      // Offset of the slots array's closing ']' (0 = appending not safe)
+    int32_t element_count;   // Elements in the slots array, tombstones included
+} SlotIndexHeader;
+
+// Slot list row: occupied flag, track totals, short artist/album/genre prefixes and year
+// (32 bytes, ~6.3 KB for 200 slots)
+typedef struct {
+    uint8_t occupied;
+    uint8_t track_count;
+    uint16_t total_seconds;  // Clamped at 65535 (18 h)
+    char artist[SUMMARY_ARTIST_LEN];
+    char album[SUMMARY_ALBUM_LEN];
+    uint16_t year;           // 0 = unknown
+    char genre[SUMMARY_GENRE_LEN];
+} SlotSummary;
+
+// Slot list order (VIEW_SLOT_LIST, Left cycles). Sorted modes list occupied slots only.
+typedef enum {
+    SortModeSlot,    // Physical slot order
+    SortModeArtist,  // Then album, then slot
+    SortModeAlbum,   // Then artist, then slot
+    SortModeYear,    // Unknown years last; then artist, album, slot
+    SortModeGenre,   // No genre last; then artist, album, slot
+    SortModeCount,
+} SortMode;
+
+// Occupied slots in each sorted mode's order (orders[mode - 1]), stored after the summary rows.
+// A changed row is moved by one binary search and two memmoves, never re-sorted.
+typedef struct {
+    uint16_t count;  // Occupied slots, listed in every order
+    uint8_t orders[SORT_ORDER_COUNT][MAX_SLOTS];
+} SlotSortOrders;
+
+// Collection totals of one Changer - moved by the difference whenever a summary row changes
+typedef struct {
+    int32_t albums;   // Occupied slots
+    int32_t tracks;
+    int32_t seconds;
+} CollectionStats;
+
+// One counter of a top-N table; count may over-state by up to error (key took over an evicted one)
+typedef struct {
+    char key[STATS_KEY_LEN];
+    uint16_t count;
+    uint16_t error;
+} StatsCounter;
+
+// Statistics breakdowns of the current Changer, allocated when Statistics first needs them.
+// Slots below scanned are counted; each one's contribution is remembered so edits move it.
+typedef struct {
+    StatsCounter artists[STATS_TOP_KEYS];
+    StatsCounter genres[STATS_TOP_KEYS];
+    uint16_t decades[STATS_DECADES];
+    uint8_t slot_artist[MAX_SLOTS];   // Counter each slot is counted in (STATS_NO_COUNTER = none)
+    uint8_t slot_genre[MAX_SLOTS];
+    uint8_t slot_decade[MAX_SLOTS];   // Bucket each slot counted (STATS_NO_DECADE = none)
+    int32_t scanned;                  // Slots fed by the pass so far
+} CollectionBreakdown;
+
+// Header of flipchanger_<id>.sum; stamped with the slot store (and journal) it summarizes, plus totals
+typedef struct {
+    uint32_t magic;          // SLOT_SUMMARY_MAGIC
+    uint16_t version;        // SLOT_SUMMARY_VERSION
+    uint16_t entry_size;     // sizeof(SlotSummary)
+    uint32_t store_size;     // .json (or .bin in binary mode)
+    uint32_t store_mtime;
+    uint32_t journal_size;
+    CollectionStats stats;   // Totals over every row (not part of the stamp)
+    uint8_t occupancy[(MAX_SLOTS + 7) / 8];  // Occupied flag of every row, one bit each (not part of the stamp)
+} SlotSummaryHeader;
+
+// One posting of the term index: a word and where it occurs (16 bytes, ordered by memcmp)
+typedef struct {
+    char term[SEARCH_TERM_LEN];  // Upper-case word prefix, NUL-padded
+    uint8_t slot;                // Slot index
+    uint8_t field;               // SEARCH_FIELD_ARTIST, SEARCH_FIELD_ALBUM or SEARCH_FIELD_TRACK + track
+} TermEntry;
+
+// Header of flipchanger_<id>.trm; stamped like the slot summary. Slots saved after the build are
+// flagged dirty (header rewritten in place) and searched from their records instead.
+typedef struct {
+    uint32_t magic;          // TERM_INDEX_MAGIC
+    uint16_t version;        // TERM_INDEX_VERSION
+    uint16_t entry_size;     // sizeof(TermEntry)
+    uint32_t store_size;     // Stamp of the slot store, as in SlotSummaryHeader
+    uint32_t store_mtime;
+    uint32_t journal_size;
+    uint32_t entry_count;
+    uint8_t dirty[(MAX_SLOTS + 7) / 8];
+} TermIndexHeader;
+
+// One slot in the global catalog: upper-cased, trimmed keys ("" and "" = empty slot)
+typedef struct {
+    char artist[CATALOG_KEY_LEN];
+    char album[CATALOG_KEY_LEN];
+} CatalogEntry;
+
+// Catalog column: which Changer it holds, stamped with that Changer's slot store
+typedef struct {
+    char changer_id[CHANGER_ID_LEN];  // "" = free (columns of deleted Changers are reused too)
+    uint32_t store_size;              // .bin if present, else .json, as in SlotSummaryHeader
+    uint32_t store_mtime;
+    uint32_t journal_size;
+    uint8_t complete;                 // Every slot imported; cleared when the stamp stops matching
+    uint8_t reserved[3];
+} CatalogColumn;
+
+// Header of flipchanger_catalog.dat; column C's entries start at sizeof(header) + C * MAX_SLOTS entries
+typedef struct {
+    uint32_t magic;          // CATALOG_MAGIC
+    uint16_t version;        // CATALOG_VERSION
+    uint16_t entry_size;     // sizeof(CatalogEntry)
+    CatalogColumn columns[MAX_CHANGERS];
+} CatalogHeader;
+
+// Term index rebuild in progress. Postings collect in run; each full run is sorted and merged
+// into the run files on SD like a binary counter (file of level L holds 2^L runs).
+typedef struct {
+    TermEntry run[SEARCH_RUN_ENTRIES];
+    int32_t run_count;
+    int32_t scanned;   // Slots indexed so far
+    uint8_t levels;    // Bit L set: run file of level L exists
+    bool queued;       // A StorageRequestTermBuild is waiting in the queue
+} TermBuild;
+
+// Candidate set of one query prefix (Search), cached per query length: a typed character only
+// narrows the set of the prefix before it, a deleted one goes back to the cached set
+typedef struct {
+    uint8_t match[(MAX_SLOTS + 7) / 8];  // Slots matching every word of the prefix (all slots before a word)
+    uint32_t low;                        // Postings of the prefix's last word: [low, high) in the term index
+    uint32_t high;
+} SearchLevel;
+
+// Search view state, kept while the view (or a slot opened from it) is shown
+typedef struct {
+    char query[SEARCH_QUERY_LEN];
+    SearchLevel levels[SEARCH_QUERY_LEN];  // Search: levels[n] matches query[0..n)
+    int32_t level_first;                   // Search: levels[level_first..level_count) are cached;
+    int32_t level_count;                   //   level_count 0 = start over (store or index changed)
+    uint8_t fields[MAX_SLOTS];             // Search: where fields_word matched each slot (SEARCH_FIELD_*, 0xFF = no)
+    char fields_word[SEARCH_TERM_LEN];     // Search: first query word fields belongs to
+    uint8_t base_slots[SEARCH_MAX_HITS];   // Find Disc: hits of the last catalog scan
+    uint8_t base_changers[SEARCH_MAX_HITS];
+    CatalogEntry base_keys[SEARCH_MAX_HITS];
+    int32_t base_count;
+    int32_t base_len;                      // Find Disc: query length scanned for, -1 = none
+    bool base_more;                        // Find Disc: the scan stopped at SEARCH_MAX_HITS
+    uint32_t masks[SEARCH_QUERY_LEN];      // Find Disc: base hits matching query[0..n), n >= base_len
+    uint8_t hits[SEARCH_MAX_HITS];        // Listed slot indexes, ascending
+    uint8_t hit_fields[SEARCH_MAX_HITS];  // Where the first query word matched (SEARCH_FIELD_*)
+    int32_t hit_count;
+    int32_t match_count;                  // Search: every match, listed or not
+    int32_t selected;                     // Highlighted hit
+    bool more;                            // Matches beyond SEARCH_MAX_HITS are not listed
+    bool pending;                         // Query posted (or waiting for the index build)
+    bool searched;                        // hits belong to a finished search
+    bool in_results;                      // Up/Down move through hits instead of the character picker
+    bool global;                          // Find Disc: hits come from the catalog, across Changers
+    uint8_t hit_changers[SEARCH_MAX_HITS];               // Find Disc: registry index of each hit
+    char hit_labels[SEARCH_MAX_HITS][SEARCH_LABEL_LEN];  // Find Disc: catalog keys of each hit
+} SearchState;
+
+// Byte range of one slot object in the JSON file (length 0 = no object)
+typedef struct {
+    uint32_t offset;
+    uint32_t length;
+} SlotIndexEntry;
+
 // Application state
 typedef struct {
     Gui* gui;
@@ -88,16 +430,44 @@ typedef struct {
     Storage* storage;
     
     // Changers registry
-    Changer changers[MAX_CHANGERS];
+    Changer* changers;                         // Heap array, changer_capacity entries
     int32_t changer_count;
+    int32_t changer_capacity;
     char current_changer_id[CHANGER_ID_LEN];   // ID of selected Changer
     int32_t current_changer_index;             // Index in changers[] or -1 if none
 
     // Data - only cache a few slots in memory, rest on SD card
-    Slot slots[SLOT_CACHE_SIZE];  // Cache for visible slots
+    CachedSlot slots[SLOT_CACHE_SIZE];  // LRU cache of individually loaded slots, keyed by slot_number
+    SlotArenaBlock* arena;       // Strings of the cached slots, re-packed as evictions leave garbage
+    Slot open_slot;              // Full record of the slot being viewed/edited (flipchanger_get_slot)
+    int32_t open_slot_index;     // Slot index open_slot holds, -1 = none
+    SlotSummary summary[MAX_SLOTS];  // Every slot's list row, persisted as flipchanger_<id>.sum
+    CollectionStats stats;           // Totals over summary, persisted in its header (Statistics)
+    SlotSortOrders sort;             // Sorted slot orders over summary, persisted after its rows
+    uint8_t occupancy[(MAX_SLOTS + 7) / 8];  // Bit per occupied slot, persisted in the summary header (Add CD)
+    uint8_t sort_mode;               // Slot list order (SortMode)
+    CollectionBreakdown* breakdown;  // Top artists/genres and decades, NULL until Statistics asks
+    bool breakdown_queued;           // A StorageRequestBreakdown is waiting in the queue
+    uint8_t terms_dirty[(MAX_SLOTS + 7) / 8];  // Slots saved since the term index was built
+    bool terms_valid;                // flipchanger_<id>.trm matches the store, apart from terms_dirty
+    TermBuild* term_build;           // Term index rebuild in progress, NULL = none
+    SearchState* search;             // Search view state, NULL while it is closed
+    int32_t catalog_column;          // Current Changer's column in the catalog, -1 = not imported yet
+    int32_t catalog_todo;            // Changers still to import before Find Disc can answer (-1 = unknown)
+    bool catalog_queued;             // A StorageRequestCatalogSync is waiting in the queue
+    TrackList tracks;            // Track list of tracks_slot only (Track Management)
+    int32_t tracks_slot;         // Slot index tracks belongs to, -1 = none loaded
+    bool tracks_dirty;           // tracks edited since it was last written to the track store
     int32_t total_slots;
     int32_t current_slot_index;  // Currently viewing/editing
-    int32_t cache_start_index;   // First cached slot index
+    uint32_t cache_clock;        // Bumped on every cache use (last_used stamps)
+    uint32_t cache_hits;         // Slot lookups served from RAM
+    uint32_t cache_misses;       // Slot lookups that read the SD card
+    uint8_t journal_slots[(MAX_SLOTS + 7) / 8];  // Slots with a record in the edit journal
+    uint8_t load_pending[(MAX_SLOTS + 7) / 8];   // Slots with a LoadSlot request queued (lookups)
+    bool binary_store;           // Slots live in flipchanger_<id>.bin (one record per slot)
+    bool json_export_stale;      // Binary store changed since JSON export was written
+    uint32_t last_save_writes;   // storage_file_write calls issued by the last full save
     
     // UI State
     enum {
@@ -114,6 +484,7 @@ typedef struct {
         VIEW_SPLASH,
         VIEW_HELP,
         VIEW_CONFIRM_DELETE,
+        VIEW_SEARCH,
     } current_view;
     
     int32_t details_scroll_offset;  // Scroll offset for slot details view
@@ -132,8 +503,18 @@ typedef struct {
     Changer edit_changer;         // Buffer for add/edit form
     int32_t edit_changer_index;   // -1=add new, >=0=edit existing
     int32_t edit_changer_field;   // 0=name, 1=location, 2=slots
-    uint32_t splash_start_tick;   // For splash screen timer
-    bool pending_changer_switch;  // Defer load/save to main loop (avoids stack overflow in input callback)
+    FuriTimer* splash_timer;      // One-shot, posts AppEventSplashDone
+    FuriMutex* mutex;             // Held by draw, input handling and each storage request (cache is shared)
+
+    // Storage worker
+    FuriThread* storage_thread;   // Runs every SD read/write (see StorageRequestType)
+    FuriMessageQueue* storage_queue;  // StorageRequest, posted by input handling and main
+    FuriMessageQueue* event_queue;    // AppEvent, posted by the input callback, splash timer and worker
+
+    // Slot list prefetch state
+    int32_t prefetch_step;        // Signed stride of the last list move (+-1, +-10), 0 = idle
+    int32_t prefetch_done;        // Slots fetched since that move (0 = the selected slot itself)
+    uint32_t prefetch_tick;       // Tick of the last list move
     
     // Add/Edit Input State
     enum {
@@ -172,6 +553,19 @@ bool flipchanger_save_changers(FlipChangerApp* app);
 bool flipchanger_load_data(FlipChangerApp* app);
 bool flipchanger_save_data(FlipChangerApp* app);
 void flipchanger_get_slots_path(const FlipChangerApp* app, char* path_out, size_t path_size);
+void flipchanger_get_store_path(const FlipChangerApp* app, char* path_out, size_t path_size);
+void flipchanger_get_index_path(const FlipChangerApp* app, char* path_out, size_t path_size);
+void flipchanger_get_journal_path(const FlipChangerApp* app, char* path_out, size_t path_size);
+void flipchanger_get_summary_path(const FlipChangerApp* app, char* path_out, size_t path_size);
+void flipchanger_get_tracks_path(const FlipChangerApp* app, char* path_out, size_t path_size);
+void flipchanger_get_terms_path(const FlipChangerApp* app, char* path_out, size_t path_size);
+void flipchanger_get_changer_path(const char* changer_id, const char* ext, char* path_out, size_t path_size);
+bool flipchanger_load_slot_from_sd(FlipChangerApp* app, int32_t slot_index);
+bool flipchanger_save_slot_to_sd(FlipChangerApp* app, int32_t slot_index);
+bool flipchanger_load_tracks(FlipChangerApp* app, int32_t slot_index);
+bool flipchanger_set_binary_store(FlipChangerApp* app, bool enable);
+bool flipchanger_export_json(FlipChangerApp* app);
+bool flipchanger_journal_compact(FlipChangerApp* app);
 
 // UI functions
 void flipchanger_draw_callback(Canvas* canvas, void* ctx);
@@ -186,8 +580,16 @@ void flipchanger_show_main_menu(FlipChangerApp* app);
 void flipchanger_show_slot_list(FlipChangerApp* app);
 void flipchanger_show_slot_details(FlipChangerApp* app, int32_t slot_index);
 void flipchanger_show_add_edit(FlipChangerApp* app, int32_t slot_index, bool is_new);
+void flipchanger_show_search(FlipChangerApp* app, bool global);
 
 // Utility functions
 void flipchanger_init_slots(FlipChangerApp* app, int32_t total_slots);
+Slot* flipchanger_get_slot(FlipChangerApp* app, int32_t slot_index);
+const CachedSlot* flipchanger_get_cached_slot(FlipChangerApp* app, int32_t slot_index);
+SlotLookupState flipchanger_lookup_slot(FlipChangerApp* app, int32_t slot_index, const CachedSlot** slot_out);
+TrackList* flipchanger_get_tracks(FlipChangerApp* app, int32_t slot_index);
+void flipchanger_update_cache(FlipChangerApp* app, int32_t slot_index);
 const char* flipchanger_get_slot_status(FlipChangerApp* app, int32_t slot_index);
 int32_t flipchanger_count_occupied_slots(FlipChangerApp* app);
+uint16_t flipchanger_parse_duration(const char* text);
+void flipchanger_format_duration(uint32_t seconds, char* out, size_t out_size);
@@ -0,0 +1,298 @@
+/**
+ * Slot parser microbenchmark (host build, see tools/README.md)
+ *
+ * Times flipchanger_parse_slot - the single-pass tokenizer with the key table -
+ * against the parser it replaced, which buffered each slot object and located
+ * every field with find_json_key (strstr over the object). Both read the same
+ * slots file through the chunked JsonReader, so only the parsing differs.
+ * The old path is kept verbatim below, except that it now fills the current
+ * Slot/TrackList layout (durations parsed to seconds).
+ *
+ * Usage: bench_parse FILE.json...   (host paths; see gen_fixture.py)
+ */
+
+// The parser is static - build against the app source directly
+#include "../flipchanger-app/flipchanger.c"
+#include <time.h>
+
+#define BENCH_ITERATIONS 50
+
+/* === Previous parser (find_json_key over a buffered slot object) === */
+static const char* old_skip_whitespace(const char* str) {
+    while(*str == ' ' || *str == '\t' || *str == '\n' || *str == '\r') {
+        str++;
+    }
+    return str;
+}
+
+static const char* old_read_json_string(const char* json, char* buffer, size_t buffer_size) {
+    const char* p = old_skip_whitespace(json);
+    if(*p != '"') return NULL;
+    p++;  // Skip opening quote
+
+    size_t i = 0;
+    while(*p && *p != '"' && i < buffer_size - 1) {
+        if(*p == '\\' && *(p + 1)) {
+            buffer[i++] = *(p + 1);  // \" and \\ (writer escapes both)
+            p += 2;
+        } else {
+            buffer[i++] = *p++;
+        }
+    }
+    buffer[i] = '\0';
+
+    if(*p == '"') p++;  // Skip closing quote
+    return p;
+}
+
+static const char* old_read_json_int(const char* json, int32_t* value) {
+    const char* p = old_skip_whitespace(json);
+    *value = 0;
+    bool negative = false;
+
+    if(*p == '-') {
+        negative = true;
+        p++;
+    }
+
+    while(*p >= '0' && *p <= '9') {
+        *value = *value * 10 + (*p - '0');
+        p++;
+    }
+
+    if(negative) *value = -(*value);
+    return p;
+}
+
+static const char* old_read_json_bool(const char* json, bool* value) {
+    const char* p = old_skip_whitespace(json);
+    if(strncmp(p, "true", 4) == 0) {
+        *value = true;
+        return p + 4;
+    } else if(strncmp(p, "false", 5) == 0) {
+        *value = false;
+        return p + 5;
+    }
+    return NULL;
+}
+
+static const char* old_find_json_key(const char* json, const char* key) {
+    char key_pattern[64];
+    snprintf(key_pattern, sizeof(key_pattern), "\"%s\"", key);
+    const char* found = strstr(json, key_pattern);
+    if(!found) return NULL;
+
+    const char* p = found + strlen(key_pattern);
+    p = old_skip_whitespace(p);
+    if(*p == ':') {
+        return p + 1;
+    }
+    return NULL;
+}
+
+static void old_parse_slot_object(const char* p, Slot* slot, TrackList* tracks) {
+    slot->occupied = false;
+    memset(&slot->cd, 0, sizeof(CD));
+    memset(tracks, 0, sizeof(TrackList));
+
+    const char* slot_key = old_find_json_key(p, "slot");
+    if(slot_key) {
+        old_read_json_int(slot_key, &slot->slot_number);
+    }
+    const char* occ_key = old_find_json_key(p, "occupied");
+    if(occ_key) {
+        old_read_json_bool(occ_key, &slot->occupied);
+    }
+    if(!slot->occupied) return;
+
+    const char* artist_key = old_find_json_key(p, "artist");
+    if(artist_key) {
+        old_read_json_string(artist_key, slot->cd.artist, MAX_ARTIST_LENGTH);
+    }
+    const char* album_artist_key = old_find_json_key(p, "album_artist");
+    if(album_artist_key) {
+        old_read_json_string(album_artist_key, slot->cd.album_artist, MAX_ARTIST_LENGTH);
+    }
+    const char* album_key = old_find_json_key(p, "album");
+    if(album_key) {
+        old_read_json_string(album_key, slot->cd.album, MAX_ALBUM_LENGTH);
+    }
+    const char* year_key = old_find_json_key(p, "year");
+    if(year_key) {
+        old_read_json_int(year_key, &slot->cd.year);
+    }
+    const char* disc_key = old_find_json_key(p, "disc_number");
+    if(disc_key) {
+        old_read_json_int(disc_key, &slot->cd.disc_number);
+        if(slot->cd.disc_number < 0) slot->cd.disc_number = 0;
+    }
+    const char* genre_key = old_find_json_key(p, "genre");
+    if(genre_key) {
+        old_read_json_string(genre_key, slot->cd.genre, MAX_GENRE_LENGTH);
+    }
+
+    const char* tracks_key = old_find_json_key(p, "tracks");
+    if(tracks_key) {
+        const char* track_p = old_skip_whitespace(tracks_key);
+        if(*track_p == '[') {
+            track_p++;
+            int32_t track_count = 0;
+            while(*track_p && track_count < MAX_TRACKS) {
+                track_p = old_skip_whitespace(track_p);
+                if(*track_p == ']') break;
+                if(*track_p == '{') {
+                    Track* track = &tracks->tracks[track_count];
+                    track->number = track_count + 1;
+
+                    const char* title_key = old_find_json_key(track_p, "title");
+                    if(title_key) {
+                        old_read_json_string(title_key, track->title, MAX_TRACK_TITLE_LENGTH);
+                    }
+                    const char* dur_key = old_find_json_key(track_p, "duration");
+                    if(dur_key) {
+                        char duration[16];
+                        old_read_json_string(dur_key, duration, sizeof(duration));
+                        track->seconds = flipchanger_parse_duration(duration);
+                    }
+                    const char* num_key = old_find_json_key(track_p, "num");
+                    if(num_key) {
+                        old_read_json_int(num_key, &track->number);
+                    }
+                    slot->cd.total_seconds += track->seconds;
+                    track_count++;
+                    while(*track_p && *track_p != '}') track_p++;
+                    if(*track_p == '}') track_p++;
+                } else {
+                    track_p++;
+                }
+                if(*track_p == ',') track_p++;
+            }
+            slot->cd.track_count = track_count;
+        }
+    }
+
+    const char* notes_key = old_find_json_key(p, "notes");
+    if(notes_key) {
+        old_read_json_string(notes_key, slot->cd.notes, MAX_NOTES_LENGTH);
+    }
+}
+
+/* === Harness === */
+typedef enum {
+    BenchParserOld,
+    BenchParserTokenizer,
+} BenchParser;
+
+typedef struct {
+    int32_t slots;
+    int32_t occupied;
+    int32_t tracks;
+    uint32_t checksum;  // Over every parsed field, so the two parsers can be compared
+} BenchResult;
+
+static uint32_t bench_mix(uint32_t hash, const void* data, size_t len) {
+    const uint8_t* p = data;
+    for(size_t i = 0; i < len; i++) hash = json_key_hash_step(hash, p[i]);
+    return hash;
+}
+
+static void bench_account(BenchResult* result, const Slot* slot, const TrackList* tracks) {
+    result->slots++;
+    uint32_t h = bench_mix(result->checksum, &slot->slot_number, sizeof(slot->slot_number));
+    if(slot->occupied) {
+        result->occupied++;
+        result->tracks += slot->cd.track_count;
+        h = bench_mix(h, &slot->cd, sizeof(CD));
+        h = bench_mix(h, tracks, sizeof(Track) * slot->cd.track_count);
+    }
+    result->checksum = h;
+}
+
+// Parse every slot of the file once with the chosen parser
+static bool bench_run(const char* path, BenchParser parser, BenchResult* result, Slot* slot, TrackList* tracks, char* obj) {
+    memset(result, 0, sizeof(BenchResult));
+    File* file = storage_file_alloc(NULL);
+    if(!storage_file_open(file, path, FSAM_READ, FSOM_OPEN_EXISTING)) {
+        storage_file_free(file);
+        return false;
+    }
+    JsonReader* r = json_reader_alloc(file);
+    char key[24];
+    if(json_reader_expect(r, '{')) {
+        while(json_reader_next_key(r, key, sizeof(key))) {
+            if(strcmp(key, "slots") != 0 || !json_reader_expect(r, '[')) {
+                json_reader_copy_value(r, NULL, 0);
+                continue;
+            }
+            while(json_reader_next_element(r)) {
+                // Both start zeroed; the tokenizer clears its outputs itself
+                memset(slot, 0, sizeof(Slot));
+                if(parser == BenchParserTokenizer) {
+                    flipchanger_parse_slot(r, slot, tracks, 0, MAX_SLOTS);
+                } else {
+                    json_reader_copy_value(r, obj, SLOT_JSON_MAX);
+                    old_parse_slot_object(obj, slot, tracks);
+                }
+                bench_account(result, slot, tracks);
+            }
+        }
+    }
+    free(r);
+    storage_file_close(file);
+    storage_file_free(file);
+    return true;
+}
+
+static double bench_now_ms(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1000.0 + t.tv_nsec / 1e6;
+}
+
+// Mean milliseconds per full-file parse
+static double bench_time(const char* path, BenchParser parser, BenchResult* result, Slot* slot, TrackList* tracks, char* obj) {
+    bench_run(path, parser, result, slot, tracks, obj);  // Warm-up (page cache, key hashes)
+    double start = bench_now_ms();
+    for(int32_t i = 0; i < BENCH_ITERATIONS; i++) {
+        bench_run(path, parser, result, slot, tracks, obj);
+    }
+    return (bench_now_ms() - start) / BENCH_ITERATIONS;
+}
+
+int main(int argc, char** argv) {
+    if(argc < 2) {
+        fprintf(stderr, "usage: %s FILE.json...\n", argv[0]);
+        return 2;
+    }
+    setenv("FLIPCHANGER_SD", "", 1);  // Arguments are host paths, not SD paths
+
+    Slot* slot = malloc(sizeof(Slot));
+    TrackList* tracks = malloc(sizeof(TrackList));
+    char* obj = malloc(SLOT_JSON_MAX);
+    int status = 0;
+
+    printf("%d runs per parser, mean per full-file parse\n", BENCH_ITERATIONS);
+    for(int i = 1; i < argc; i++) {
+        BenchResult old_result, new_result;
+        if(!bench_run(argv[i], BenchParserOld, &old_result, slot, tracks, obj)) {
+            fprintf(stderr, "%s: cannot open\n", argv[i]);
+            status = 1;
+            continue;
+        }
+        double old_ms = bench_time(argv[i], BenchParserOld, &old_result, slot, tracks, obj);
+        double new_ms = bench_time(argv[i], BenchParserTokenizer, &new_result, slot, tracks, obj);
+        bool same = memcmp(&old_result, &new_result, sizeof(BenchResult)) == 0;
+
+        printf("%s: %ld slots (%ld occupied, %ld tracks)\n", argv[i], (long)new_result.slots,
+               (long)new_result.occupied, (long)new_result.tracks);
+        printf("  find_json_key  %8.3f ms\n", old_ms);
+        printf("  tokenizer      %8.3f ms  (%.2fx)\n", new_ms, old_ms / new_ms);
+        printf("  results        %s\n", same ? "identical" : "DIFFER");
+        if(!same) status = 1;
+    }
+
+    free(obj);
+    free(tracks);
+    free(slot);
+    return status;
+}
@@ -0,0 +1,68 @@
+#!/usr/bin/env python3
+"""Write a FlipChanger slots file for the host tools.
+
+Every 7th slot is left empty; the rest hold a CD with 20 tracks, laid out the
+way the app writes them. With --sparse, album_artist, disc_number and notes are
+left out of each object (older files and hand edits do that), which is the
+costly case for a parser that searches for keys instead of reading them in order.
+With --registry, a Changer registry naming the file as changer_0 is written too.
+
+    gen_fixture.py [--slots N] [--sparse] [--registry CHANGERS.json] OUT.json
+"""
+
+import argparse
+import json
+
+GENRES = ["ROCK", "JAZZ", "POP"]
+TRACKS = 20
+
+
+def slot_object(number, sparse):
+    if number % 7 == 0:
+        return {"slot": number, "occupied": False}
+    cd = {"slot": number, "occupied": True, "artist": "ARTIST %d" % number}
+    if not sparse:
+        cd["album_artist"] = ""
+    cd["album"] = "ALBUM %d" % number
+    cd["year"] = 1960 + number % 60
+    if not sparse:
+        cd["disc_number"] = 0
+    cd["genre"] = GENRES[number % len(GENRES)]
+    cd["tracks"] = [
+        {"num": t + 1, "title": "TRACK %d-%d LONG TITLE TEXT" % (number, t + 1),
+         "duration": "%d:%02d" % (3 + t % 3, (t * 7) % 60)}
+        for t in range(TRACKS)
+    ]
+    if not sparse:
+        cd["notes"] = "NOTES %d" % number
+    return cd
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--slots", type=int, default=200)
+    parser.add_argument("--sparse", action="store_true")
+    parser.add_argument("--registry")
+    parser.add_argument("out")
+    args = parser.parse_args()
+
+    data = {
+        "version": 1,
+        "total_slots": args.slots,
+        "slots": [slot_object(n, args.sparse) for n in range(1, args.slots + 1)],
+    }
+    with open(args.out, "w") as f:
+        json.dump(data, f, separators=(",", ":"))
+
+    if args.registry:
+        registry = {
+            "version": 1,
+            "last_used_id": "changer_0",
+            "changers": [{"id": "changer_0", "name": "MAIN", "location": "", "total_slots": args.slots}],
+        }
+        with open(args.registry, "w") as f:
+            json.dump(registry, f, separators=(",", ":"))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,368 @@
+/**
+ * Host stand-ins for the Flipper firmware API, so flipchanger.c builds and runs
+ * on a PC for the tools in this directory.
+ *
+ * Storage is real: SD paths ("/ext/apps/Tools/...") map to files under the
+ * directory named by FLIPCHANGER_SD (default "sd"). Everything else - GUI,
+ * notifications, threads, timers, queues and mutexes - is a no-op, so the tools
+ * call the storage paths directly instead of going through the worker thread.
+ */
+
+#include <furi.h>
+#include <gui/gui.h>
+#include <notification/notification_messages.h>
+#include <storage/storage.h>
+#include <errno.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+struct File {
+    FILE* fp;
+};
+
+struct NotificationSequence {
+    int unused;
+};
+
+const NotificationSequence sequence_blink_green_100;
+const NotificationSequence sequence_blink_blue_100;
+const NotificationSequence sequence_blink_red_100;
+
+/* === Storage === */
+
+// Host path of an SD path (two rotating buffers, so rename/copy can hold both)
+static const char* host_path(const char* path) {
+    static char buf[2][512];
+    static int next = 0;
+    const char* root = getenv("FLIPCHANGER_SD");
+    next ^= 1;
+    snprintf(buf[next], sizeof(buf[next]), "%s%s", root ? root : "sd", path);
+    return buf[next];
+}
+
+File* storage_file_alloc(Storage* storage) {
+    UNUSED(storage);
+    return calloc(1, sizeof(File));
+}
+
+void storage_file_free(File* file) {
+    if(file->fp) fclose(file->fp);
+    free(file);
+}
+
+bool storage_file_open(File* file, const char* path, FS_AccessMode access_mode, FS_OpenMode open_mode) {
+    const char* p = host_path(path);
+    struct stat st;
+    bool exists = stat(p, &st) == 0;
+    const char* mode;
+    switch(open_mode) {
+    case FSOM_OPEN_EXISTING:
+        if(!exists) return false;
+        mode = (access_mode == FSAM_READ) ? "rb" : "r+b";
+        break;
+    case FSOM_CREATE_NEW:
+        if(exists) return false;
+        mode = "w+b";
+        break;
+    case FSOM_CREATE_ALWAYS:
+        mode = "w+b";
+        break;
+    case FSOM_OPEN_APPEND:
+        mode = "ab";
+        break;
+    default:
+        mode = exists ? "r+b" : "w+b";
+        break;
+    }
+    file->fp = fopen(p, mode);
+    return file->fp != NULL;
+}
+
+bool storage_file_close(File* file) {
+    if(!file->fp) return false;
+    fclose(file->fp);
+    file->fp = NULL;
+    return true;
+}
+
+size_t storage_file_read(File* file, void* buff, size_t bytes_to_read) {
+    return file->fp ? fread(buff, 1, bytes_to_read, file->fp) : 0;
+}
+
+size_t storage_file_write(File* file, const void* buff, size_t bytes_to_write) {
+    return file->fp ? fwrite(buff, 1, bytes_to_write, file->fp) : 0;
+}
+
+bool storage_file_seek(File* file, uint32_t offset, bool from_start) {
+    return file->fp && fseek(file->fp, offset, from_start ? SEEK_SET : SEEK_CUR) == 0;
+}
+
+uint64_t storage_file_size(File* file) {
+    long pos = ftell(file->fp);
+    fseek(file->fp, 0, SEEK_END);
+    long size = ftell(file->fp);
+    fseek(file->fp, pos, SEEK_SET);
+    return (uint64_t)size;
+}
+
+FS_Error storage_common_stat(Storage* storage, const char* path, FileInfo* fileinfo) {
+    UNUSED(storage);
+    struct stat st;
+    if(stat(host_path(path), &st) != 0) return FSE_NOT_EXIST;
+    if(fileinfo) {
+        fileinfo->size = (uint64_t)st.st_size;
+        fileinfo->flags = S_ISDIR(st.st_mode) ? FSF_DIRECTORY : 0;
+    }
+    return FSE_OK;
+}
+
+FS_Error storage_common_timestamp(Storage* storage, const char* path, uint32_t* timestamp) {
+    UNUSED(storage);
+    struct stat st;
+    if(stat(host_path(path), &st) != 0) return FSE_NOT_EXIST;
+    *timestamp = (uint32_t)st.st_mtime;
+    return FSE_OK;
+}
+
+FS_Error storage_common_remove(Storage* storage, const char* path) {
+    UNUSED(storage);
+    return unlink(host_path(path)) == 0 ? FSE_OK : FSE_NOT_EXIST;
+}
+
+// Fails when new_path exists, like the firmware
+FS_Error storage_common_rename(Storage* storage, const char* old_path, const char* new_path) {
+    UNUSED(storage);
+    const char* from = host_path(old_path);
+    const char* to = host_path(new_path);
+    struct stat st;
+    if(stat(to, &st) == 0) return FSE_EXIST;
+    return rename(from, to) == 0 ? FSE_OK : FSE_INTERNAL;
+}
+
+FS_Error storage_common_copy(Storage* storage, const char* old_path, const char* new_path) {
+    UNUSED(storage);
+    FILE* in = fopen(host_path(old_path), "rb");
+    if(!in) return FSE_NOT_EXIST;
+    FILE* out = fopen(host_path(new_path), "wb");
+    if(!out) {
+        fclose(in);
+        return FSE_INTERNAL;
+    }
+    char buf[512];
+    size_t n;
+    while((n = fread(buf, 1, sizeof(buf), in)) > 0) fwrite(buf, 1, n, out);
+    fclose(in);
+    return fclose(out) == 0 ? FSE_OK : FSE_INTERNAL;
+}
+
+// Creates missing parents too (the SD root tree is not there on a fresh host directory)
+FS_Error storage_common_mkdir(Storage* storage, const char* path) {
+    UNUSED(storage);
+    char p[512];
+    snprintf(p, sizeof(p), "%s", host_path(path));
+    for(char* c = p + 1; *c; c++) {
+        if(*c != '/') continue;
+        *c = '\0';
+        mkdir(p, 0755);
+        *c = '/';
+    }
+    return (mkdir(p, 0755) == 0 || errno == EEXIST) ? FSE_OK : FSE_INTERNAL;
+}
+
+/* === Everything else (no-ops) === */
+
+uint32_t furi_get_tick(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (uint32_t)(t.tv_sec * 1000 + t.tv_nsec / 1000000);
+}
+
+void furi_delay_ms(uint32_t ms) {
+    usleep(ms * 1000);
+}
+
+uint32_t furi_ms_to_ticks(uint32_t ms) {
+    return ms;
+}
+
+void* furi_record_open(const char* name) {
+    return (void*)name;
+}
+
+void furi_record_close(const char* name) {
+    UNUSED(name);
+}
+
+size_t memmgr_get_free_heap(void) {
+    return 64 * 1024;
+}
+
+FuriMessageQueue* furi_message_queue_alloc(uint32_t msg_count, uint32_t msg_size) {
+    UNUSED(msg_count);
+    UNUSED(msg_size);
+    return NULL;
+}
+
+void furi_message_queue_free(FuriMessageQueue* queue) {
+    UNUSED(queue);
+}
+
+FuriStatus furi_message_queue_put(FuriMessageQueue* queue, const void* msg, uint32_t timeout) {
+    UNUSED(queue);
+    UNUSED(msg);
+    UNUSED(timeout);
+    return FuriStatusError;
+}
+
+FuriStatus furi_message_queue_get(FuriMessageQueue* queue, void* msg, uint32_t timeout) {
+    UNUSED(queue);
+    UNUSED(msg);
+    UNUSED(timeout);
+    return FuriStatusErrorTimeout;
+}
+
+FuriThread* furi_thread_alloc_ex(const char* name, uint32_t stack_size, FuriThreadCallback callback, void* context) {
+    UNUSED(name);
+    UNUSED(stack_size);
+    UNUSED(callback);
+    UNUSED(context);
+    return NULL;
+}
+
+void furi_thread_start(FuriThread* thread) {
+    UNUSED(thread);
+}
+
+bool furi_thread_join(FuriThread* thread) {
+    UNUSED(thread);
+    return true;
+}
+
+void furi_thread_free(FuriThread* thread) {
+    UNUSED(thread);
+}
+
+FuriTimer* furi_timer_alloc(FuriTimerCallback callback, FuriTimerType type, void* context) {
+    UNUSED(callback);
+    UNUSED(type);
+    UNUSED(context);
+    return NULL;
+}
+
+void furi_timer_free(FuriTimer* timer) {
+    UNUSED(timer);
+}
+
+FuriStatus furi_timer_start(FuriTimer* timer, uint32_t ticks) {
+    UNUSED(timer);
+    UNUSED(ticks);
+    return FuriStatusOk;
+}
+
+FuriStatus furi_timer_stop(FuriTimer* timer) {
+    UNUSED(timer);
+    return FuriStatusOk;
+}
+
+FuriMutex* furi_mutex_alloc(FuriMutexType type) {
+    UNUSED(type);
+    return NULL;
+}
+
+void furi_mutex_free(FuriMutex* mutex) {
+    UNUSED(mutex);
+}
+
+FuriStatus furi_mutex_acquire(FuriMutex* mutex, uint32_t timeout) {
+    UNUSED(mutex);
+    UNUSED(timeout);
+    return FuriStatusOk;
+}
+
+FuriStatus furi_mutex_release(FuriMutex* mutex) {
+    UNUSED(mutex);
+    return FuriStatusOk;
+}
+
+void notification_message(NotificationApp* app, const NotificationSequence* sequence) {
+    UNUSED(app);
+    UNUSED(sequence);
+}
+
+ViewPort* view_port_alloc(void) {
+    return NULL;
+}
+
+void view_port_free(ViewPort* view_port) {
+    UNUSED(view_port);
+}
+
+void view_port_draw_callback_set(ViewPort* view_port, ViewPortDrawCallback callback, void* context) {
+    UNUSED(view_port);
+    UNUSED(callback);
+    UNUSED(context);
+}
+
+void view_port_input_callback_set(ViewPort* view_port, ViewPortInputCallback callback, void* context) {
+    UNUSED(view_port);
+    UNUSED(callback);
+    UNUSED(context);
+}
+
+void view_port_update(ViewPort* view_port) {
+    UNUSED(view_port);
+}
+
+void gui_add_view_port(Gui* gui, ViewPort* view_port, GuiLayer layer) {
+    UNUSED(gui);
+    UNUSED(view_port);
+    UNUSED(layer);
+}
+
+void gui_remove_view_port(Gui* gui, ViewPort* view_port) {
+    UNUSED(gui);
+    UNUSED(view_port);
+}
+
+void canvas_clear(Canvas* canvas) {
+    UNUSED(canvas);
+}
+
+void canvas_set_font(Canvas* canvas, Font font) {
+    UNUSED(canvas);
+    UNUSED(font);
+}
+
+void canvas_draw_str(Canvas* canvas, int32_t x, int32_t y, const char* str) {
+    UNUSED(canvas);
+    UNUSED(x);
+    UNUSED(y);
+    UNUSED(str);
+}
+
+void canvas_draw_str_aligned(Canvas* canvas, int32_t x, int32_t y, Align horizontal, Align vertical, const char* str) {
+    UNUSED(horizontal);
+    UNUSED(vertical);
+    canvas_draw_str(canvas, x, y, str);
+}
+
+void canvas_draw_box(Canvas* canvas, int32_t x, int32_t y, size_t width, size_t height) {
+    UNUSED(canvas);
+    UNUSED(x);
+    UNUSED(y);
+    UNUSED(width);
+    UNUSED(height);
+}
+
+void canvas_draw_line(Canvas* canvas, int32_t x1, int32_t y1, int32_t x2, int32_t y2) {
+    UNUSED(canvas);
+    UNUSED(x1);
+    UNUSED(y1);
+    UNUSED(x2);
+    UNUSED(y2);
+}
+
+void canvas_invert_color(Canvas* canvas) {
+    UNUSED(canvas);
+}
@@ -0,0 +1,64 @@
+// Host stand-in for the parts of furi.h FlipChanger uses (tools builds only)
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#define UNUSED(x) (void)(x)
+#define furi_assert(x) ((void)(x))
+#define FURI_LOG_E(tag, ...) ((void)(tag))
+#define FURI_LOG_W(tag, ...) ((void)(tag))
+#define FURI_LOG_I(tag, ...) ((void)(tag))
+#define FURI_LOG_D(tag, ...) ((void)(tag))
+#define COUNT_OF(x) (sizeof(x) / sizeof(x[0]))
+#define FuriWaitForever 0xFFFFFFFFU
+
+typedef enum {
+    FuriStatusOk = 0,
+    FuriStatusError = -1,
+    FuriStatusErrorTimeout = -2,
+} FuriStatus;
+
+uint32_t furi_get_tick(void);
+void furi_delay_ms(uint32_t ms);
+uint32_t furi_ms_to_ticks(uint32_t ms);
+void* furi_record_open(const char* name);
+void furi_record_close(const char* name);
+size_t memmgr_get_free_heap(void);
+
+typedef struct FuriMessageQueue FuriMessageQueue;
+FuriMessageQueue* furi_message_queue_alloc(uint32_t msg_count, uint32_t msg_size);
+void furi_message_queue_free(FuriMessageQueue* queue);
+FuriStatus furi_message_queue_put(FuriMessageQueue* queue, const void* msg, uint32_t timeout);
+FuriStatus furi_message_queue_get(FuriMessageQueue* queue, void* msg, uint32_t timeout);
+
+typedef struct FuriThread FuriThread;
+typedef int32_t (*FuriThreadCallback)(void* context);
+FuriThread* furi_thread_alloc_ex(const char* name, uint32_t stack_size, FuriThreadCallback callback, void* context);
+void furi_thread_start(FuriThread* thread);
+bool furi_thread_join(FuriThread* thread);
+void furi_thread_free(FuriThread* thread);
+
+typedef enum {
+    FuriTimerTypeOnce = 0,
+    FuriTimerTypePeriodic = 1,
+} FuriTimerType;
+typedef void (*FuriTimerCallback)(void* context);
+typedef struct FuriTimer FuriTimer;
+FuriTimer* furi_timer_alloc(FuriTimerCallback callback, FuriTimerType type, void* context);
+void furi_timer_free(FuriTimer* timer);
+FuriStatus furi_timer_start(FuriTimer* timer, uint32_t ticks);
+FuriStatus furi_timer_stop(FuriTimer* timer);
+
+typedef enum {
+    FuriMutexTypeNormal,
+    FuriMutexTypeRecursive,
+} FuriMutexType;
+typedef struct FuriMutex FuriMutex;
+FuriMutex* furi_mutex_alloc(FuriMutexType type);
+void furi_mutex_free(FuriMutex* mutex);
+FuriStatus furi_mutex_acquire(FuriMutex* mutex, uint32_t timeout);
+FuriStatus furi_mutex_release(FuriMutex* mutex);
@@ -0,0 +1,8 @@
+#pragma once
+
+#define RECORD_NOTIFICATION "notification"
+
+typedef struct NotificationApp NotificationApp;
+typedef struct NotificationSequence NotificationSequence;
+
+void notification_message(NotificationApp* app, const NotificationSequence* sequence);
@@ -0,0 +1,6 @@
+#pragma once
+#include "notification.h"
+
+extern const NotificationSequence sequence_blink_green_100;
+extern const NotificationSequence sequence_blink_blue_100;
+extern const NotificationSequence sequence_blink_red_100;
@@ -0,0 +1,102 @@
+/**
+ * Reproduction: a dirty cached slot whose file object was moved out of slot order
+ *
+ * flipchanger_json_update_slot appends a slot that outgrew its place and leaves
+ * a tombstone behind, so slot 3 can sit after slot 200 in the file. If slot 3 is
+ * then edited in the cache alongside a higher slot (5), the merge in
+ * flipchanger_write_slots_file must drop the moved copy; writing it after the
+ * fresh one makes the .idx and every full-file scan pick the stale data.
+ *
+ * Expects FLIPCHANGER_SD to hold a fresh 200-slot file (make repro sets it up).
+ * Exits 0 when the edit survives the save.
+ */
+
+#include "../flipchanger-app/flipchanger.c"
+
+static FlipChangerApp* repro_app_alloc(void) {
+    FlipChangerApp* app = calloc(1, sizeof(FlipChangerApp));
+    app->storage = (Storage*)1;  // Never dereferenced by the host storage
+    app->running = true;
+    flipchanger_load_changers(app);
+    flipchanger_load_data(app);
+    return app;
+}
+
+// Copies of the slot's album text in the slots file (any position)
+static int32_t repro_count_in_file(FlipChangerApp* app, const char* album) {
+    char path[64];
+    flipchanger_get_slots_path(app, path, sizeof(path));
+    File* file = storage_file_alloc(app->storage);
+    if(!storage_file_open(file, path, FSAM_READ, FSOM_OPEN_EXISTING)) {
+        storage_file_free(file);
+        return -1;
+    }
+    char pattern[80];
+    snprintf(pattern, sizeof(pattern), "\"album\":\"%s\"", album);
+    size_t size = (size_t)storage_file_size(file);
+    char* text = malloc(size + 1);
+    text[storage_file_read(file, text, size)] = '\0';
+    int32_t count = 0;
+    for(const char* p = text; (p = strstr(p, pattern)) != NULL; p++) count++;
+    free(text);
+    storage_file_close(file);
+    storage_file_free(file);
+    return count;
+}
+
+int main(void) {
+    FlipChangerApp* app = repro_app_alloc();
+    Slot* slot = malloc(sizeof(Slot));
+    TrackList* tracks = malloc(sizeof(TrackList));
+
+    // 1. Grow slot 3 past its byte range so it is appended at the end of the array
+    flipchanger_read_slot(app, 2, slot);
+    flipchanger_tracks_read(app, slot, tracks);
+    slot->occupied = true;
+    strcpy(slot->cd.album, "MOVED");
+    memset(slot->cd.notes, 'X', MAX_NOTES_LENGTH - 1);
+    slot->cd.notes[MAX_NOTES_LENGTH - 1] = '\0';
+    if(!flipchanger_json_update_slot(app, slot, tracks)) {
+        printf("setup failed: slot 3 not rewritten\n");
+        return 2;
+    }
+
+    // 2. Edit slots 3 and 5 in the cache only
+    flipchanger_update_cache(app, 2);
+    Slot* edit = flipchanger_get_slot(app, 2);
+    if(!edit) return 2;
+    strcpy(edit->cd.album, "FRESH");
+    edit->cd.notes[0] = '\0';
+    flipchanger_update_cache(app, 4);
+    edit = flipchanger_get_slot(app, 4);
+    if(!edit) return 2;
+    strcpy(edit->cd.album, "FRESH 5");
+    flipchanger_cache_commit(app);
+    for(int32_t i = 0; i < SLOT_CACHE_SIZE; i++) {
+        if(app->slots[i].slot_number == 3 || app->slots[i].slot_number == 5) app->slots[i].dirty = true;
+    }
+
+    // 3. Full save (journal compaction, then the merge)
+    if(!flipchanger_save_data(app)) {
+        printf("save failed\n");
+        return 2;
+    }
+
+    // 4. Reload through the offset index and count copies in the file
+    FlipChangerApp* reloaded = repro_app_alloc();
+    flipchanger_read_slot(reloaded, 2, slot);
+    bool slot3_ok = strcmp(slot->cd.album, "FRESH") == 0;
+    printf("slot 3 after reload: %s\n", slot->cd.album);
+    flipchanger_read_slot(reloaded, 4, slot);
+    bool slot5_ok = strcmp(slot->cd.album, "FRESH 5") == 0;
+    printf("slot 5 after reload: %s\n", slot->cd.album);
+    int32_t moved = repro_count_in_file(reloaded, "MOVED");
+    int32_t fresh = repro_count_in_file(reloaded, "FRESH");
+    printf("copies in file: MOVED %ld, FRESH %ld\n", (long)moved, (long)fresh);
+
+    bool ok = slot3_ok && slot5_ok && moved == 0 && fresh == 1;
+    printf("%s\n", ok ? "PASS" : "FAIL: edit to moved slot 3 lost");
+    free(tracks);
+    free(slot);
+    return ok ? 0 : 1;
+}